@@ -30,6 +30,7 @@
 // compiled independently if that is preferable.
 //-----------------------------------------------------------------------------
 
+#include "../src/dpiArrow.c"
 #include "../src/dpiConn.c"
 #include "../src/dpiContext.c"
 #include "../src/dpiData.c"
@@ -43,12 +44,15 @@
 #include "../src/dpiHandleList.c"
 #include "../src/dpiHandlePool.c"
 #include "../src/dpiJson.c"
+#include "../src/dpiJsonText.c"
 #include "../src/dpiLob.c"
+#include "../src/dpiLobReader.c"
 #include "../src/dpiMsgProps.c"
 #include "../src/dpiObjectAttr.c"
 #include "../src/dpiObject.c"
 #include "../src/dpiObjectType.c"
 #include "../src/dpiOci.c"
+#include "../src/dpiOson.c"
 #include "../src/dpiOracleType.c"
 #include "../src/dpiPool.c"
 #include "../src/dpiQueue.c"
@@ -69,7 +69,7 @@ extern "C" {
 
 // define ODPI-C version information
 #define DPI_MAJOR_VERSION   6
-#define DPI_MINOR_VERSION   0
+#define DPI_MINOR_VERSION   1
 #define DPI_PATCH_LEVEL     0
 #define DPI_VERSION_SUFFIX
 
@@ -404,6 +404,16 @@ typedef uint32_t dpiTpcEndFlags;
 #define DPI_TPC_END_NORMAL                          0
 #define DPI_TPC_END_SUSPEND                         0x00100000
 
+// vector distance metrics
+typedef uint8_t dpiVectorDistanceMetric;
+#define DPI_VECTOR_DISTANCE_COSINE                  1
+#define DPI_VECTOR_DISTANCE_DOT                     2
+#define DPI_VECTOR_DISTANCE_EUCLIDEAN               3
+#define DPI_VECTOR_DISTANCE_EUCLIDEAN_SQUARED       4
+#define DPI_VECTOR_DISTANCE_HAMMING                 5
+#define DPI_VECTOR_DISTANCE_JACCARD                 6
+#define DPI_VECTOR_DISTANCE_MANHATTAN               7
+
 // vector flags
 typedef uint8_t dpiVectorFlags;
 #define DPI_VECTOR_FLAGS_FLEXIBLE_DIM               0x01
@@ -431,6 +441,7 @@ typedef struct dpiDeqOptions dpiDeqOptions;
 typedef struct dpiEnqOptions dpiEnqOptions;
 typedef struct dpiJson dpiJson;
 typedef struct dpiLob dpiLob;
+typedef struct dpiLobReader dpiLobReader;
 typedef struct dpiMsgProps dpiMsgProps;
 typedef struct dpiObject dpiObject;
 typedef struct dpiObjectAttr dpiObjectAttr;
@@ -491,6 +502,8 @@ typedef struct dpiXid dpiXid;
 //-----------------------------------------------------------------------------
 typedef int (*dpiAccessTokenCallback)(void *context,
         dpiAccessToken *accessToken);
+typedef void (*dpiSodaInsertCallback)(void *context, uint32_t numDocs,
+        uint64_t totalNumDocs);
 
 
 //-----------------------------------------------------------------------------
@@ -864,6 +877,9 @@ struct dpiSubscrCreateParams {
     uint8_t groupingType;
     uint64_t outRegId;
     int clientInitiated;
+    uint32_t maxQueuedMessages;
+    uint32_t coalesceWindow;
+    uint32_t coalesceRowThreshold;
 };
 
 // structure used for transferring messages in subscription callbacks
@@ -954,6 +970,47 @@ struct dpiXid {
 };
 
 
+//-----------------------------------------------------------------------------
+// Apache Arrow C Data Interface
+// (https://arrow.apache.org/docs/format/CDataInterface.html)
+//-----------------------------------------------------------------------------
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED   1
+#define ARROW_FLAG_NULLABLE             2
+#define ARROW_FLAG_MAP_KEYS_SORTED      4
+
+// structure used for describing the type of an Arrow array
+struct ArrowSchema {
+    const char *format;
+    const char *name;
+    const char *metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema *dictionary;
+    void (*release)(struct ArrowSchema*);
+    void *private_data;
+};
+
+// structure used for describing the data of an Arrow array
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray *dictionary;
+    void (*release)(struct ArrowArray*);
+    void *private_data;
+};
+
+#endif
+
+
 //-----------------------------------------------------------------------------
 // Context Methods (dpiContext)
 //-----------------------------------------------------------------------------
@@ -1099,6 +1156,9 @@ DPI_EXPORT int dpiConn_getLTXID(dpiConn *conn, const char **value,
 DPI_EXPORT int dpiConn_getMaxOpenCursors(dpiConn *conn,
         uint32_t *maxOpenCursors);
 
+// return whether or not the connection is in non-blocking mode
+DPI_EXPORT int dpiConn_getNonBlocking(dpiConn *conn, int *enabled);
+
 // create a new object type and return it for subsequent object creation
 DPI_EXPORT int dpiConn_getObjectType(dpiConn *conn, const char *name,
         uint32_t nameLength, dpiObjectType **objType);
@@ -1222,6 +1282,9 @@ DPI_EXPORT int dpiConn_setInternalName(dpiConn *conn, const char *value,
 DPI_EXPORT int dpiConn_setModule(dpiConn *conn, const char *value,
         uint32_t valueLength);
 
+// enable or disable non-blocking mode on the connection
+DPI_EXPORT int dpiConn_setNonBlocking(dpiConn *conn, int enabled);
+
 // generic method for setting an OCI connection attribute
 // WARNING: use only as directed by Oracle
 DPI_EXPORT int dpiConn_setOciAttr(dpiConn *conn, uint32_t handleType,
@@ -1506,10 +1569,20 @@ DPI_EXPORT int dpiEnqOptions_setVisibility(dpiEnqOptions *options,
 // add a reference to the JSON
 DPI_EXPORT int dpiJson_addRef(dpiJson *json);
 
+// return the value of the JSON object, or of the given node, as JSON text
+DPI_EXPORT int dpiJson_getText(dpiJson *json, const dpiJsonNode *node,
+        const char **value, uint64_t *valueLength);
+
 // return the value of the JSON object, as a hierarchy of nodes
 DPI_EXPORT int dpiJson_getValue(dpiJson *json, uint32_t options,
         dpiJsonNode **topNode);
 
+// return the value of OSON data as a hierarchy of nodes, optionally only
+// decoding the node identified by a path
+DPI_EXPORT int dpiJson_getValueFromOson(dpiJson *json, const char *value,
+        uint64_t valueLength, const char *path, uint32_t pathLength,
+        uint32_t options, dpiJsonNode **node);
+
 // release a reference to the JSON
 DPI_EXPORT int dpiJson_release(dpiJson *json);
 
@@ -1537,6 +1610,10 @@ DPI_EXPORT int dpiLob_closeResource(dpiLob *lob);
 // create a copy of the LOB
 DPI_EXPORT int dpiLob_copy(dpiLob *lob, dpiLob **copiedLob);
 
+// create a copy of the LOB associated with a different connection
+DPI_EXPORT int dpiLob_copyToConn(dpiLob *lob, dpiConn *conn,
+        dpiLob **copiedLob);
+
 // get buffer size in bytes for a LOB
 DPI_EXPORT int dpiLob_getBufferSize(dpiLob *lob, uint64_t sizeInChars,
         uint64_t *sizeInBytes);
@@ -1561,6 +1638,10 @@ DPI_EXPORT int dpiLob_getSize(dpiLob *lob, uint64_t *size);
 // return the type of the LOB
 DPI_EXPORT int dpiLob_getType(dpiLob *lob, dpiOracleTypeNum *type);
 
+// create a reader for streaming the contents of the LOB
+DPI_EXPORT int dpiLob_newReader(dpiLob *lob, uint64_t offset, uint64_t amount,
+        dpiLobReader **reader);
+
 // open the LOB's resources (used to improve performance of multiple
 // read/writes operations)
 DPI_EXPORT int dpiLob_openResource(dpiLob *lob);
@@ -1589,6 +1670,28 @@ DPI_EXPORT int dpiLob_writeBytes(dpiLob *lob, uint64_t offset,
         const char *value, uint64_t valueLength);
 
 
+//-----------------------------------------------------------------------------
+// LOB Reader Methods (dpiLobReader)
+//-----------------------------------------------------------------------------
+
+// add a reference to the LOB reader
+DPI_EXPORT int dpiLobReader_addRef(dpiLobReader *reader);
+
+// close the LOB reader, abandoning any data that has not yet been read
+DPI_EXPORT int dpiLobReader_close(dpiLobReader *reader);
+
+// read the next piece of the LOB
+DPI_EXPORT int dpiLobReader_read(dpiLobReader *reader, const char **value,
+        uint64_t *valueLength);
+
+// read the remaining pieces of the LOB and write them to a file descriptor
+DPI_EXPORT int dpiLobReader_readToFd(dpiLobReader *reader, int fd,
+        uint64_t *numBytesWritten);
+
+// release a reference to the LOB reader
+DPI_EXPORT int dpiLobReader_release(dpiLobReader *reader);
+
+
 //-----------------------------------------------------------------------------
 // Message Properties Methods (dpiMsgProps)
 //-----------------------------------------------------------------------------
@@ -1692,6 +1795,10 @@ DPI_EXPORT int dpiObject_addRef(dpiObject *obj);
 DPI_EXPORT int dpiObject_appendElement(dpiObject *obj,
         dpiNativeTypeNum nativeTypeNum, dpiData *value);
 
+// append a number of elements to the collection
+DPI_EXPORT int dpiObject_appendElements(dpiObject *obj,
+        dpiNativeTypeNum nativeTypeNum, uint32_t numElements, dpiData *data);
+
 // copy the object and return the copied object
 DPI_EXPORT int dpiObject_copy(dpiObject *obj, dpiObject **copiedObj);
 
@@ -1702,6 +1809,11 @@ DPI_EXPORT int dpiObject_deleteElementByIndex(dpiObject *obj, int32_t index);
 DPI_EXPORT int dpiObject_getAttributeValue(dpiObject *obj, dpiObjectAttr *attr,
         dpiNativeTypeNum nativeTypeNum, dpiData *value);
 
+// get the values of a number of attributes
+DPI_EXPORT int dpiObject_getAttributeValues(dpiObject *obj,
+        uint16_t numAttributes, dpiObjectAttr **attributes,
+        const dpiNativeTypeNum *nativeTypeNums, dpiData *data);
+
 // return whether an element exists in a collection at the specified index
 DPI_EXPORT int dpiObject_getElementExistsByIndex(dpiObject *obj, int32_t index,
         int *exists);
@@ -1710,6 +1822,11 @@ DPI_EXPORT int dpiObject_getElementExistsByIndex(dpiObject *obj, int32_t index,
 DPI_EXPORT int dpiObject_getElementValueByIndex(dpiObject *obj, int32_t index,
         dpiNativeTypeNum nativeTypeNum, dpiData *value);
 
+// get the values of all of the elements in a collection
+DPI_EXPORT int dpiObject_getElementValues(dpiObject *obj,
+        dpiNativeTypeNum nativeTypeNum, uint32_t *numElements,
+        int32_t *indices, dpiData *data);
+
 // return the first index used in a collection
 DPI_EXPORT int dpiObject_getFirstIndex(dpiObject *obj, int32_t *index,
         int *exists);
@@ -1886,9 +2003,15 @@ DPI_EXPORT int dpiQueue_deqOne(dpiQueue *queue, dpiMsgProps **props);
 DPI_EXPORT int dpiQueue_enqMany(dpiQueue *queue, uint32_t numProps,
         dpiMsgProps **props);
 
+// add a message to the batch of messages to enqueue to the queue
+DPI_EXPORT int dpiQueue_enqBatched(dpiQueue *queue, dpiMsgProps *props);
+
 // enqueue a single message to the queue
 DPI_EXPORT int dpiQueue_enqOne(dpiQueue *queue, dpiMsgProps *props);
 
+// enqueue all messages in the batch of messages to enqueue to the queue
+DPI_EXPORT int dpiQueue_flushEnq(dpiQueue *queue);
+
 // get a reference to the dequeue options associated with the queue
 DPI_EXPORT int dpiQueue_getDeqOptions(dpiQueue *queue,
         dpiDeqOptions **options);
@@ -1900,6 +2023,10 @@ DPI_EXPORT int dpiQueue_getEnqOptions(dpiQueue *queue,
 // release a reference to the queue
 DPI_EXPORT int dpiQueue_release(dpiQueue *queue);
 
+// set the thresholds at which batched messages are enqueued
+DPI_EXPORT int dpiQueue_setEnqBatching(dpiQueue *queue, uint32_t maxMessages,
+        uint32_t maxDelay);
+
 // reconfigure the current pool
 DPI_EXPORT int dpiPool_reconfigure(dpiPool *pool, uint32_t minSessions,
         uint32_t maxSessions, uint32_t sessionIncrement);
@@ -1932,6 +2059,9 @@ DPI_EXPORT int dpiSodaColl_find(dpiSodaColl *coll,
 DPI_EXPORT int dpiSodaColl_findOne(dpiSodaColl *coll,
         const dpiSodaOperOptions *options, uint32_t flags, dpiSodaDoc **doc);
 
+// insert all documents in the batch of documents to insert
+DPI_EXPORT int dpiSodaColl_flushInsert(dpiSodaColl *coll);
+
 // get the data guide for the collection
 DPI_EXPORT int dpiSodaColl_getDataGuide(dpiSodaColl *coll, uint32_t flags,
         dpiSodaDoc **doc);
@@ -1948,6 +2078,16 @@ DPI_EXPORT int dpiSodaColl_getMetadata(dpiSodaColl *coll, const char **value,
 DPI_EXPORT int dpiSodaColl_getName(dpiSodaColl *coll, const char **value,
         uint32_t *valueLength);
 
+// add a document with encoded JSON content to the batch of documents to
+// insert into the SODA collection
+DPI_EXPORT int dpiSodaColl_insertBatched(dpiSodaColl *coll, const char *key,
+        uint32_t keyLength, const char *content, uint32_t contentLength);
+
+// add a document with JSON content to the batch of documents to insert into
+// the SODA collection
+DPI_EXPORT int dpiSodaColl_insertJsonBatched(dpiSodaColl *coll,
+        const char *key, uint32_t keyLength, const dpiJsonNode *content);
+
 // insert multiple documents into the SODA collection
 DPI_EXPORT int dpiSodaColl_insertMany(dpiSodaColl *coll, uint32_t numDocs,
         dpiSodaDoc **docs, uint32_t flags, dpiSodaDoc **insertedDocs);
@@ -1990,6 +2130,11 @@ DPI_EXPORT int dpiSodaColl_save(dpiSodaColl *coll, dpiSodaDoc *doc,
 DPI_EXPORT int dpiSodaColl_saveWithOptions(dpiSodaColl *coll, dpiSodaDoc *doc,
         dpiSodaOperOptions *options, uint32_t flags, dpiSodaDoc **savedDoc);
 
+// set the size at which batched documents are inserted
+DPI_EXPORT int dpiSodaColl_setInsertBatching(dpiSodaColl *coll,
+        uint32_t maxDocs, uint32_t flags, dpiSodaInsertCallback callback,
+        void *callbackContext);
+
 // remove all of the documents from a SODA collection
 DPI_EXPORT int dpiSodaColl_truncate(dpiSodaColl *coll);
 
@@ -2107,6 +2252,11 @@ DPI_EXPORT int dpiSodaDocCursor_close(dpiSodaDocCursor *cursor);
 DPI_EXPORT int dpiSodaDocCursor_getNext(dpiSodaDocCursor *cursor,
         uint32_t flags, dpiSodaDoc **doc);
 
+// get the next set of documents from the SODA document cursor
+DPI_EXPORT int dpiSodaDocCursor_getNextMany(dpiSodaDocCursor *cursor,
+        uint32_t flags, uint32_t maxDocs, dpiSodaDoc **docs,
+        uint32_t *numDocs);
+
 // release a reference to the SODA document cursor
 DPI_EXPORT int dpiSodaDocCursor_release(dpiSodaDocCursor *cursor);
 
@@ -2157,6 +2307,12 @@ DPI_EXPORT int dpiStmt_execute(dpiStmt *stmt, dpiExecMode mode,
 DPI_EXPORT int dpiStmt_executeMany(dpiStmt *stmt, dpiExecMode mode,
         uint32_t numIters);
 
+// execute the statement multiple times using the rows of an Arrow struct
+// array as the bind values, in batches of at most the given size
+DPI_EXPORT int dpiStmt_executeManyFromArrow(dpiStmt *stmt, dpiExecMode mode,
+        const struct ArrowSchema *schema, const struct ArrowArray *array,
+        uint32_t batchSize);
+
 // fetch a single row and return the index into the defined variables
 // this will internally perform any execute and array fetch as needed
 DPI_EXPORT int dpiStmt_fetch(dpiStmt *stmt, int *found,
@@ -2279,6 +2435,18 @@ DPI_EXPORT int dpiRowid_release(dpiRowid *subscr);
 // add a reference to the subscription
 DPI_EXPORT int dpiSubscr_addRef(dpiSubscr *subscr);
 
+// dequeue the next queued message from the subscription
+DPI_EXPORT int dpiSubscr_dequeueMessage(dpiSubscr *subscr,
+        dpiSubscrMessage **message);
+
+// free a message dequeued from the subscription
+DPI_EXPORT int dpiSubscr_freeMessage(dpiSubscr *subscr,
+        dpiSubscrMessage *message);
+
+// return the number of messages discarded because the queue was full
+DPI_EXPORT int dpiSubscr_getNumDroppedMessages(dpiSubscr *subscr,
+        uint64_t *value);
+
 // prepare statement for registration with subscription
 DPI_EXPORT int dpiSubscr_prepareStmt(dpiSubscr *subscr, const char *sql,
         uint32_t sqlLength, dpiStmt **stmt);
@@ -2298,6 +2466,11 @@ DPI_EXPORT int dpiVar_addRef(dpiVar *var);
 DPI_EXPORT int dpiVar_copyData(dpiVar *var, uint32_t pos, dpiVar *sourceVar,
         uint32_t sourcePos);
 
+// copy the values of the variable to a column of values
+DPI_EXPORT int dpiVar_getColumn(dpiVar *var, uint32_t pos, uint32_t numValues,
+        void *values, uint32_t *valuesLength, uint32_t *offsets,
+        uint8_t *nullBitmap);
+
 // return the number of elements in a PL/SQL index-by table
 DPI_EXPORT int dpiVar_getNumElementsInArray(dpiVar *var,
         uint32_t *numElements);
@@ -2310,6 +2483,11 @@ DPI_EXPORT int dpiVar_getReturnedData(dpiVar *var, uint32_t pos,
 // return the size in bytes of the buffer used for fetching/binding
 DPI_EXPORT int dpiVar_getSizeInBytes(dpiVar *var, uint32_t *sizeInBytes);
 
+// copy the dimensions of a number of vectors to a matrix
+DPI_EXPORT int dpiVar_getVectorMatrix(dpiVar *var, uint32_t pos,
+        uint32_t numRows, dpiVectorFormat format, uint32_t numDimensions,
+        void *matrix, uint8_t *nullBitmap);
+
 // release a reference to the variable
 DPI_EXPORT int dpiVar_release(dpiVar *var);
 
@@ -2317,6 +2495,11 @@ DPI_EXPORT int dpiVar_release(dpiVar *var);
 DPI_EXPORT int dpiVar_setFromBytes(dpiVar *var, uint32_t pos,
         const char *value, uint32_t valueLength);
 
+// set the values of the variable from a column of values
+DPI_EXPORT int dpiVar_setFromColumn(dpiVar *var, uint32_t pos,
+        uint32_t numValues, const void *values, const uint32_t *offsets,
+        const uint8_t *nullBitmap);
+
 // set the value of the variable from a JSON handle
 DPI_EXPORT int dpiVar_setFromJson(dpiVar *var, uint32_t pos, dpiJson *json);
 
@@ -2336,6 +2519,12 @@ DPI_EXPORT int dpiVar_setFromStmt(dpiVar *var, uint32_t pos, dpiStmt *stmt);
 DPI_EXPORT int dpiVar_setFromVector(dpiVar *var, uint32_t pos,
         dpiVector *vector);
 
+// set the values of the variable from the rows of a matrix of vectors
+DPI_EXPORT int dpiVar_setFromVectorMatrix(dpiVar *var, uint32_t pos,
+        uint32_t numRows, dpiVectorFormat format, uint32_t numDimensions,
+        const void *values, const uint32_t *rowOffsets,
+        const uint32_t *sparseIndices, const uint8_t *nullBitmap);
+
 // set the number of elements in a PL/SQL index-by table
 DPI_EXPORT int dpiVar_setNumElementsInArray(dpiVar *var, uint32_t numElements);
 
@@ -2346,6 +2535,15 @@ DPI_EXPORT int dpiVar_setNumElementsInArray(dpiVar *var, uint32_t numElements);
 // add a reference to the vector
 DPI_EXPORT int dpiVector_addRef(dpiVector *vector);
 
+// return the distance between two vectors
+DPI_EXPORT int dpiVector_getDistance(dpiVector *vector1, dpiVector *vector2,
+        dpiVectorDistanceMetric metric, double *distance);
+
+// return the distances between a vector and each of a number of vectors
+DPI_EXPORT int dpiVector_getDistances(dpiVector *vector, uint32_t numVectors,
+        dpiVector **vectors, dpiVectorDistanceMetric metric,
+        double *distances);
+
 // get information about the vector
 DPI_EXPORT int dpiVector_getValue(dpiVector *vector, dpiVectorInfo *info);
 
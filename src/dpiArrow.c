@@ -0,0 +1,394 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpiArrow.c
+//   Implementation of transferring columns of data described by the Apache
+// Arrow C data interface to variables.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+// constants used for converting Arrow dates and timestamps
+#define DPI_ARROW_SECONDS_PER_DAY       86400
+#define DPI_ARROW_DAYS_TO_EPOCH         719468  // 0000-03-01 to 1970-01-01
+
+
+//-----------------------------------------------------------------------------
+// dpiArrow__getTypes() [PRIVATE]
+//   Determine the Oracle and native types used for transferring the column of
+// data described by the given schema, as well as the number of buffers the
+// array is expected to have and, for dates and timestamps, the number of
+// units per second (0 indicates that the values are days).
+//-----------------------------------------------------------------------------
+static int dpiArrow__getTypes(const struct ArrowSchema *schema,
+        uint32_t column, dpiOracleTypeNum *oracleTypeNum,
+        dpiNativeTypeNum *nativeTypeNum, int64_t *numBuffers,
+        int64_t *unitsPerSecond, dpiError *error)
+{
+    const char *format = schema->format;
+
+    *numBuffers = 2;
+    *unitsPerSecond = 0;
+    if (!format || schema->dictionary)
+        return dpiError__set(error, "check format",
+                DPI_ERR_ARROW_FORMAT_NOT_SUPPORTED, format ? format : "",
+                column);
+
+    // fixed width and variable width types (single character formats)
+    if (format[0] != '\0' && format[1] == '\0') {
+        switch (format[0]) {
+            case 'n':
+                *oracleTypeNum = DPI_ORACLE_TYPE_VARCHAR;
+                *nativeTypeNum = DPI_NATIVE_TYPE_BYTES;
+                *numBuffers = 0;
+                return DPI_SUCCESS;
+            case 'b':
+                *oracleTypeNum = DPI_ORACLE_TYPE_BOOLEAN;
+                *nativeTypeNum = DPI_NATIVE_TYPE_BOOLEAN;
+                return DPI_SUCCESS;
+            case 'c':
+            case 'C':
+            case 's':
+            case 'S':
+            case 'i':
+            case 'I':
+            case 'l':
+                *oracleTypeNum = DPI_ORACLE_TYPE_NATIVE_INT;
+                *nativeTypeNum = DPI_NATIVE_TYPE_INT64;
+                return DPI_SUCCESS;
+            case 'L':
+                *oracleTypeNum = DPI_ORACLE_TYPE_NATIVE_UINT;
+                *nativeTypeNum = DPI_NATIVE_TYPE_UINT64;
+                return DPI_SUCCESS;
+            case 'f':
+                *oracleTypeNum = DPI_ORACLE_TYPE_NATIVE_FLOAT;
+                *nativeTypeNum = DPI_NATIVE_TYPE_FLOAT;
+                return DPI_SUCCESS;
+            case 'g':
+                *oracleTypeNum = DPI_ORACLE_TYPE_NATIVE_DOUBLE;
+                *nativeTypeNum = DPI_NATIVE_TYPE_DOUBLE;
+                return DPI_SUCCESS;
+            case 'u':
+            case 'U':
+                *oracleTypeNum = DPI_ORACLE_TYPE_VARCHAR;
+                *nativeTypeNum = DPI_NATIVE_TYPE_BYTES;
+                *numBuffers = 3;
+                return DPI_SUCCESS;
+            case 'z':
+            case 'Z':
+                *oracleTypeNum = DPI_ORACLE_TYPE_RAW;
+                *nativeTypeNum = DPI_NATIVE_TYPE_BYTES;
+                *numBuffers = 3;
+                return DPI_SUCCESS;
+            default:
+                break;
+        }
+
+    // dates (days or milliseconds since the epoch)
+    } else if (strcmp(format, "tdD") == 0 || strcmp(format, "tdm") == 0) {
+        *oracleTypeNum = DPI_ORACLE_TYPE_DATE;
+        *nativeTypeNum = DPI_NATIVE_TYPE_TIMESTAMP;
+        *unitsPerSecond = (format[2] == 'm') ? 1000 : 0;
+        return DPI_SUCCESS;
+
+    // timestamps (an optional time zone indicates the values are in UTC)
+    } else if (strncmp(format, "ts", 2) == 0 && format[2] != '\0' &&
+            format[3] == ':') {
+        switch (format[2]) {
+            case 's':
+                *unitsPerSecond = 1;
+                break;
+            case 'm':
+                *unitsPerSecond = 1000;
+                break;
+            case 'u':
+                *unitsPerSecond = 1000000;
+                break;
+            case 'n':
+                *unitsPerSecond = 1000000000;
+                break;
+            default:
+                return dpiError__set(error, "check format",
+                        DPI_ERR_ARROW_FORMAT_NOT_SUPPORTED, format, column);
+        }
+        *oracleTypeNum = (format[4] == '\0') ? DPI_ORACLE_TYPE_TIMESTAMP :
+                DPI_ORACLE_TYPE_TIMESTAMP_TZ;
+        *nativeTypeNum = DPI_NATIVE_TYPE_TIMESTAMP;
+        return DPI_SUCCESS;
+    }
+
+    return dpiError__set(error, "check format",
+            DPI_ERR_ARROW_FORMAT_NOT_SUPPORTED, format, column);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiArrow__getValueLength() [PRIVATE]
+//   Return the length of the variable width value at the given index of the
+// array.
+//-----------------------------------------------------------------------------
+static uint64_t dpiArrow__getValueLength(const struct ArrowArray *array,
+        int largeOffsets, int64_t index)
+{
+    const int64_t *largeOffsetsBuffer;
+    const int32_t *offsetsBuffer;
+
+    if (largeOffsets) {
+        largeOffsetsBuffer = (const int64_t*) array->buffers[1];
+        return (uint64_t) (largeOffsetsBuffer[index + 1] -
+                largeOffsetsBuffer[index]);
+    }
+    offsetsBuffer = (const int32_t*) array->buffers[1];
+    return (uint64_t) (uint32_t) (offsetsBuffer[index + 1] -
+            offsetsBuffer[index]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiArrow__isNull() [PRIVATE]
+//   Return whether the value at the given index of the array is null. A
+// missing validity bitmap indicates that none of the values are null.
+//-----------------------------------------------------------------------------
+static int dpiArrow__isNull(const struct ArrowArray *array, int64_t index)
+{
+    const uint8_t *bitmap;
+
+    if (array->n_buffers == 0)
+        return 1;
+    bitmap = (const uint8_t*) array->buffers[0];
+    return (bitmap && !((bitmap[index >> 3] >> (index & 7)) & 1));
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiArrow__newVar() [INTERNAL]
+//   Validate the child array and schema for the given column of a struct
+// array and create a variable capable of holding maxArraySize values from it.
+// Variable width columns are sized to hold the longest value in the array.
+//-----------------------------------------------------------------------------
+int dpiArrow__newVar(dpiConn *conn, const struct ArrowSchema *schema,
+        const struct ArrowArray *array, uint32_t column,
+        uint32_t maxArraySize, dpiVar **var, dpiError *error)
+{
+    const struct ArrowArray *child = array->children[column];
+    int64_t i, index, numBuffers, unitsPerSecond;
+    dpiNativeTypeNum nativeTypeNum;
+    dpiOracleTypeNum oracleTypeNum;
+    uint64_t size, valueLength;
+    int largeOffsets;
+    dpiData *data;
+
+    // determine the types to use and validate the array
+    if (dpiArrow__getTypes(schema->children[column], column, &oracleTypeNum,
+            &nativeTypeNum, &numBuffers, &unitsPerSecond, error) < 0)
+        return DPI_FAILURE;
+    if (!child || !child->release || child->n_buffers != numBuffers ||
+            child->offset < 0 ||
+            child->length < array->offset + array->length ||
+            (numBuffers > 1 && !child->buffers[1]) ||
+            (child->length > 0 && numBuffers > 2 && !child->buffers[2]))
+        return dpiError__set(error, "check array",
+                DPI_ERR_INVALID_ARROW_ARRAY, column);
+
+    // determine the size of the longest variable width value
+    size = 1;
+    if (numBuffers > 2) {
+        largeOffsets = (schema->children[column]->format[0] == 'U' ||
+                schema->children[column]->format[0] == 'Z');
+        for (i = 0; i < array->length; i++) {
+            index = child->offset + array->offset + i;
+            valueLength = dpiArrow__getValueLength(child, largeOffsets,
+                    index);
+            if (valueLength > size)
+                size = valueLength;
+        }
+        if (size > DPI_MAX_VAR_BUFFER_SIZE)
+            return dpiError__set(error, "check size",
+                    DPI_ERR_BUFFER_SIZE_TOO_LARGE, size,
+                    DPI_MAX_VAR_BUFFER_SIZE);
+    }
+
+    return dpiVar__allocate(conn, oracleTypeNum, nativeTypeNum, maxArraySize,
+            (uint32_t) size, 1, 0, NULL, var, &data, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiArrow__setTimestamp() [PRIVATE]
+//   Set the timestamp from the number of units since the epoch (1970-01-01
+// 00:00:00 UTC). If the number of units per second is zero, the value is the
+// number of days since the epoch. The conversion to a civil date uses the
+// proleptic Gregorian calendar.
+//-----------------------------------------------------------------------------
+static void dpiArrow__setTimestamp(dpiTimestamp *timestamp, int64_t value,
+        int64_t unitsPerSecond)
+{
+    int64_t days, seconds, fraction, era, dayOfEra, yearOfEra, dayOfYear;
+    int64_t monthIndex;
+
+    // separate the value into days, seconds and fractional seconds
+    if (unitsPerSecond == 0) {
+        days = value;
+        seconds = fraction = 0;
+    } else {
+        seconds = value / unitsPerSecond;
+        fraction = value % unitsPerSecond;
+        if (fraction < 0) {
+            fraction += unitsPerSecond;
+            seconds--;
+        }
+        days = seconds / DPI_ARROW_SECONDS_PER_DAY;
+        seconds %= DPI_ARROW_SECONDS_PER_DAY;
+        if (seconds < 0) {
+            seconds += DPI_ARROW_SECONDS_PER_DAY;
+            days--;
+        }
+    }
+
+    // convert the number of days to a civil date
+    days += DPI_ARROW_DAYS_TO_EPOCH;
+    era = ((days >= 0) ? days : days - 146096) / 146097;
+    dayOfEra = days - era * 146097;
+    yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 -
+            dayOfEra / 146096) / 365;
+    dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 -
+            yearOfEra / 100);
+    monthIndex = (5 * dayOfYear + 2) / 153;
+    timestamp->day = (uint8_t) (dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+    timestamp->month = (uint8_t) ((monthIndex < 10) ? monthIndex + 3 :
+            monthIndex - 9);
+    timestamp->year = (int16_t) (yearOfEra + era * 400 +
+            (timestamp->month <= 2));
+    timestamp->hour = (uint8_t) (seconds / 3600);
+    timestamp->minute = (uint8_t) ((seconds / 60) % 60);
+    timestamp->second = (uint8_t) (seconds % 60);
+    timestamp->fsecond = (unitsPerSecond == 0) ? 0 :
+            (uint32_t) (fraction * (1000000000 / unitsPerSecond));
+    timestamp->tzHourOffset = 0;
+    timestamp->tzMinuteOffset = 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiArrow__setVar() [INTERNAL]
+//   Transfer numRows values of the given column of a struct array, starting at
+// the given row, to the first positions of the variable. A row of the struct
+// array that is null results in null values for each of its columns. The
+// values are transferred one row at a time according to the Arrow format of
+// the column.
+//-----------------------------------------------------------------------------
+int dpiArrow__setVar(dpiVar *var, const struct ArrowSchema *schema,
+        const struct ArrowArray *array, uint32_t column, int64_t startRow,
+        uint32_t numRows, dpiError *error)
+{
+    const struct ArrowArray *child = array->children[column];
+    int64_t index, valueOffset, numBuffers, unitsPerSecond;
+    dpiData *data = var->buffer.externalData;
+    dpiNativeTypeNum nativeTypeNum;
+    dpiOracleTypeNum oracleTypeNum;
+    const void *values;
+    uint64_t valueLength;
+    char format;
+    uint32_t i;
+
+    if (dpiArrow__getTypes(schema->children[column], column, &oracleTypeNum,
+            &nativeTypeNum, &numBuffers, &unitsPerSecond, error) < 0)
+        return DPI_FAILURE;
+    format = schema->children[column]->format[0];
+    values = (numBuffers > 1) ? child->buffers[1] : NULL;
+    for (i = 0; i < numRows; i++) {
+        index = array->offset + startRow + i;
+        data[i].isNull = (dpiArrow__isNull(array, index) ||
+                dpiArrow__isNull(child, child->offset + index));
+        if (data[i].isNull)
+            continue;
+        index += child->offset;
+        switch (format) {
+            case 'b':
+                data[i].value.asBoolean =
+                        (((const uint8_t*) values)[index >> 3] >>
+                        (index & 7)) & 1;
+                break;
+            case 'c':
+                data[i].value.asInt64 = ((const int8_t*) values)[index];
+                break;
+            case 'C':
+                data[i].value.asInt64 = ((const uint8_t*) values)[index];
+                break;
+            case 's':
+                data[i].value.asInt64 = ((const int16_t*) values)[index];
+                break;
+            case 'S':
+                data[i].value.asInt64 = ((const uint16_t*) values)[index];
+                break;
+            case 'i':
+                data[i].value.asInt64 = ((const int32_t*) values)[index];
+                break;
+            case 'I':
+                data[i].value.asInt64 = ((const uint32_t*) values)[index];
+                break;
+            case 'l':
+                data[i].value.asInt64 = ((const int64_t*) values)[index];
+                break;
+            case 'L':
+                data[i].value.asUint64 = ((const uint64_t*) values)[index];
+                break;
+            case 'f':
+                data[i].value.asFloat = ((const float*) values)[index];
+                break;
+            case 'g':
+                data[i].value.asDouble = ((const double*) values)[index];
+                break;
+            case 'u':
+            case 'z':
+            case 'U':
+            case 'Z':
+                if (format == 'U' || format == 'Z') {
+                    valueOffset = ((const int64_t*) values)[index];
+                    valueLength = dpiArrow__getValueLength(child, 1, index);
+                } else {
+                    valueOffset = ((const int32_t*) values)[index];
+                    valueLength = dpiArrow__getValueLength(child, 0, index);
+                }
+                if (dpiVar__setFromBytes(var, i,
+                        (valueLength == 0) ? "" :
+                                (const char*) child->buffers[2] + valueOffset,
+                        (uint32_t) valueLength, error) < 0)
+                    return DPI_FAILURE;
+                break;
+            case 't':
+                dpiArrow__setTimestamp(&data[i].value.asTimestamp,
+                        (unitsPerSecond == 0) ?
+                                ((const int32_t*) values)[index] :
+                                ((const int64_t*) values)[index],
+                        unitsPerSecond);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return DPI_SUCCESS;
+}
@@ -53,6 +53,8 @@ static int dpiConn__setAttributesFromCreateParams(dpiConn *conn, void *handle,
         const char *password, uint32_t passwordLength,
         const dpiCommonCreateParams *commonParams,
         const dpiConnCreateParams *params, int *used, dpiError *error);
+static int dpiConn__setNonBlocking(dpiConn *conn, int enabled,
+        dpiError *error);
 static int dpiConn__setShardingKey(dpiConn *conn, void **shardingKey,
         void *handle, uint32_t handleType, uint32_t attribute,
         const char *action, dpiShardingKeyColumn *columns, uint8_t numColumns,
@@ -140,6 +142,14 @@ static int dpiConn__close(dpiConn *conn, uint32_t mode, const char *tag,
     dpiStmt *stmt;
     dpiLob *lob;
 
+    // return the connection to blocking mode, if needed, so that the calls
+    // made during close complete before returning and so that connections
+    // returned to a pool are not left in non-blocking mode; drop the session
+    // if this cannot be done
+    if (conn->nonBlocking && !conn->deadSession &&
+            dpiConn__setNonBlocking(conn, 0, error) < 0)
+        conn->deadSession = 1;
+
     // rollback any outstanding transaction, if one is in progress; drop the
     // session if any errors take place
     txnInProgress = 0;
@@ -386,11 +396,13 @@ int dpiConn__create(dpiConn *conn, const dpiContext *context,
     // do dead connection detection
     conn->creating = 1;
 
-    // allocate handle lists for statements, LOBs and objects
+    // allocate handle lists for statements, LOBs, queues and objects
     if (dpiHandleList__create(&conn->openStmts, error) < 0)
         return DPI_FAILURE;
     if (dpiHandleList__create(&conn->openLobs, error) < 0)
         return DPI_FAILURE;
+    if (dpiHandleList__create(&conn->openQueues, error) < 0)
+        return DPI_FAILURE;
     if (dpiHandleList__create(&conn->objects, error) < 0)
         return DPI_FAILURE;
 
@@ -589,6 +601,10 @@ void dpiConn__free(dpiConn *conn, dpiError *error)
         dpiHandleList__free(conn->openLobs);
         conn->openLobs = NULL;
     }
+    if (conn->openQueues) {
+        dpiHandleList__free(conn->openQueues);
+        conn->openQueues = NULL;
+    }
     if (conn->objects) {
         dpiHandleList__free(conn->objects);
         conn->objects = NULL;
@@ -1314,6 +1330,31 @@ static int dpiConn__setAttributeText(dpiConn *conn, uint32_t attribute,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiConn__setNonBlocking() [INTERNAL]
+//   Enables or disables non-blocking mode on the server handle. OCI toggles
+// the mode each time the attribute is set so the current mode is checked
+// first and the attribute is only set if the mode needs to change.
+//-----------------------------------------------------------------------------
+static int dpiConn__setNonBlocking(dpiConn *conn, int enabled,
+        dpiError *error)
+{
+    uint8_t currentMode;
+
+    if (dpiOci__attrGet(conn->serverHandle, DPI_OCI_HTYPE_SERVER,
+            &currentMode, NULL, DPI_OCI_ATTR_NONBLOCKING_MODE,
+            "get non-blocking mode", error) < 0)
+        return DPI_FAILURE;
+    if ((currentMode != 0) != (enabled != 0) &&
+            dpiOci__attrSet(conn->serverHandle, DPI_OCI_HTYPE_SERVER, NULL, 0,
+                    DPI_OCI_ATTR_NONBLOCKING_MODE, "set non-blocking mode",
+                    error) < 0)
+        return DPI_FAILURE;
+    conn->nonBlocking = (enabled != 0);
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiConn__setShardingKey() [INTERNAL]
 //   Using the specified columns, create a sharding key and set it on the given
@@ -1677,12 +1718,44 @@ int dpiConn_beginSessionlessTransaction(dpiConn *conn,
 //-----------------------------------------------------------------------------
 int dpiConn_breakExecution(dpiConn *conn)
 {
+    dpiQueue *queue;
     dpiError error;
+    dpiStmt *stmt;
+    uint32_t i;
     int status;
 
     if (dpiConn__check(conn, __func__, &error) < 0)
         return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
     status = dpiOci__break(conn, &error);
+    if (status < 0)
+        return dpiGen__endPublicFn(conn, status, &error);
+
+    // in non-blocking mode the call being interrupted is abandoned, so the
+    // connection must be reset
+    if (conn->nonBlocking)
+        status = dpiOci__reset(conn, &error);
+
+    // the statements and queues on the connection must no longer consider a
+    // call to be in progress; this is done whether or not the connection is
+    // still in non-blocking mode so that the next call on them always starts
+    // afresh instead of continuing the call that was interrupted
+    if (conn->env->threaded)
+        dpiMutex__acquire(conn->env->mutex);
+    for (i = 0; conn->openStmts && i < conn->openStmts->numSlots; i++) {
+        stmt = (dpiStmt*) conn->openStmts->handles[i];
+        if (!stmt)
+            continue;
+        stmt->executePending = 0;
+        stmt->fetchPending = 0;
+    }
+    for (i = 0; conn->openQueues && i < conn->openQueues->numSlots; i++) {
+        queue = (dpiQueue*) conn->openQueues->handles[i];
+        if (queue)
+            queue->deqPending = 0;
+    }
+    if (conn->env->threaded)
+        dpiMutex__release(conn->env->mutex);
+
     return dpiGen__endPublicFn(conn, status, &error);
 }
 
@@ -2224,6 +2297,22 @@ int dpiConn_getMaxOpenCursors(dpiConn *conn, uint32_t *maxOpenCursors)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiConn_getNonBlocking() [PUBLIC]
+//   Returns whether or not the connection is in non-blocking mode.
+//-----------------------------------------------------------------------------
+int dpiConn_getNonBlocking(dpiConn *conn, int *enabled)
+{
+    dpiError error;
+
+    if (dpiConn__check(conn, __func__, &error) < 0)
+        return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(conn, enabled)
+    *enabled = conn->nonBlocking;
+    return dpiGen__endPublicFn(conn, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiConn_getObjectType() [PUBLIC]
 //   Look up an object type given its name and return it.
@@ -2871,6 +2960,22 @@ int dpiConn_setModule(dpiConn *conn, const char *value, uint32_t valueLength)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiConn_setNonBlocking() [PUBLIC]
+//   Enables or disables non-blocking mode on the connection.
+//-----------------------------------------------------------------------------
+int dpiConn_setNonBlocking(dpiConn *conn, int enabled)
+{
+    dpiError error;
+    int status;
+
+    if (dpiConn__check(conn, __func__, &error) < 0)
+        return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+    status = dpiConn__setNonBlocking(conn, enabled, &error);
+    return dpiGen__endPublicFn(conn, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiConn_setOciAttr() [PUBLIC]
 //   Set the OCI attribute directly. This is intended for testing of attributes
@@ -213,11 +213,18 @@ void dpiContext__initSodaOperOptions(dpiSodaOperOptions *options)
 
 //-----------------------------------------------------------------------------
 // dpiContext__initSubscrCreateParams() [INTERNAL]
-//   Initialize the subscription creation parameters to default values.
+//   Initialize the subscription creation parameters to default values. The
+// members following clientInitiated were added in version 6.1 and are not
+// part of the structure used by applications built for an earlier version.
 //-----------------------------------------------------------------------------
-void dpiContext__initSubscrCreateParams(dpiSubscrCreateParams *params)
+void dpiContext__initSubscrCreateParams(const dpiContext *context,
+        dpiSubscrCreateParams *params)
 {
-    memset(params, 0, sizeof(dpiSubscrCreateParams));
+    if (context->dpiMinorVersion > 0) {
+        memset(params, 0, sizeof(dpiSubscrCreateParams));
+    } else {
+        memset(params, 0, offsetof(dpiSubscrCreateParams, maxQueuedMessages));
+    }
     params->subscrNamespace = DPI_SUBSCR_NAMESPACE_DBCHANGE;
     params->groupingType = DPI_SUBSCR_GROUPING_TYPE_SUMMARY;
 }
@@ -417,6 +424,6 @@ int dpiContext_initSubscrCreateParams(const dpiContext *context,
         return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
     DPI_CHECK_PTR_NOT_NULL(context, params)
 
-    dpiContext__initSubscrCreateParams(params);
+    dpiContext__initSubscrCreateParams(context, params);
     return dpiGen__endPublicFn(context, DPI_SUCCESS, &error);
 }
@@ -36,6 +36,11 @@
 #define DPI_MS_SECOND     1000      // ms per sec
 #define DPI_MS_FSECOND    1000000   // 1000 * 1000
 
+// forward declarations of internal functions only used in this file
+static void dpiDataBuffer__toOracleNumberFromDigits(int isNegative,
+        int16_t decimalPointIndex, uint8_t numDigits, uint8_t *digits,
+        void *oracleValue);
+
 
 //-----------------------------------------------------------------------------
 // dpiDataBuffer__fromOracleDate() [INTERNAL]
@@ -428,50 +433,51 @@ int dpiDataBuffer__toOracleIntervalYM(dpiDataBuffer *data, dpiEnv *env,
 
 
 //-----------------------------------------------------------------------------
-// dpiDataBuffer__toOracleNumberFromDouble() [INTERNAL]
-//   Populate the data in an OCINumber structure from a double.
+// dpiDataBuffer__toOracleNumberFromAbsInteger() [INTERNAL]
+//   Populate the data in an OCINumber structure from the absolute value of an
+// integer and its sign.
 //-----------------------------------------------------------------------------
-int dpiDataBuffer__toOracleNumberFromDouble(dpiDataBuffer *data,
-        dpiError *error, void *oracleValue)
+static void dpiDataBuffer__toOracleNumberFromAbsInteger(uint64_t value,
+        int isNegative, void *oracleValue)
 {
-    if (isnan(data->asDouble))
-        return dpiError__set(error, "convert double to Oracle number",
-                DPI_ERR_NAN);
-    return dpiOci__numberFromReal(data->asDouble, oracleValue, error);
-}
+    uint8_t numDigits = 0, digits[24], reversedDigits[20], i;
+    int16_t decimalPointIndex = 0;
 
+    // determine the digits, from least significant to most significant,
+    // skipping any trailing zeroes
+    while (value > 0 && value % 10 == 0) {
+        decimalPointIndex++;
+        value /= 10;
+    }
+    while (value > 0) {
+        reversedDigits[numDigits++] = (uint8_t) (value % 10);
+        value /= 10;
+    }
+    decimalPointIndex += numDigits;
+    for (i = 0; i < numDigits; i++)
+        digits[i] = reversedDigits[numDigits - i - 1];
 
-//-----------------------------------------------------------------------------
-// dpiDataBuffer__toOracleNumberFromInteger() [INTERNAL]
-//   Populate the data in an OCINumber structure from an integer.
-//-----------------------------------------------------------------------------
-int dpiDataBuffer__toOracleNumberFromInteger(dpiDataBuffer *data,
-        dpiError *error, void *oracleValue)
-{
-    return dpiOci__numberFromInt(&data->asInt64, sizeof(int64_t),
-            DPI_OCI_NUMBER_SIGNED, oracleValue, error);
+    dpiDataBuffer__toOracleNumberFromDigits(isNegative, decimalPointIndex,
+            numDigits, digits, oracleValue);
 }
 
 
 //-----------------------------------------------------------------------------
-// dpiDataBuffer__toOracleNumberFromText() [INTERNAL]
-//   Populate the data in an OCINumber structure from text.
+// dpiDataBuffer__toOracleNumberFromDigits() [INTERNAL]
+//   Populate the data in an OCINumber structure from its constituent
+// components: the sign, the position of the decimal point and the decimal
+// digits without any leading or trailing zeroes. The digits array must have
+// room for two additional digits.
 //-----------------------------------------------------------------------------
-int dpiDataBuffer__toOracleNumberFromText(dpiDataBuffer *data, dpiEnv *env,
-        dpiError *error, void *oracleValue)
+static void dpiDataBuffer__toOracleNumberFromDigits(int isNegative,
+        int16_t decimalPointIndex, uint8_t numDigits, uint8_t *digits,
+        void *oracleValue)
 {
-    uint8_t numDigits, digits[DPI_NUMBER_AS_TEXT_CHARS], *source, *target, i;
-    int isNegative, prependZero, appendSentinel;
-    dpiBytes *value = &data->asBytes;
-    int16_t decimalPointIndex;
-    uint8_t byte, numPairs;
+    int prependZero, appendSentinel;
+    uint8_t byte, numPairs, i;
+    uint8_t *source, *target;
     int8_t ociExponent;
 
-    // parse the string into its constituent components
-    if (dpiUtils__parseNumberString(value->ptr, value->length, env->charsetId,
-            &isNegative, &decimalPointIndex, &numDigits, digits, error) < 0)
-        return DPI_FAILURE;
-
     // if the exponent is odd, prepend a zero
     prependZero = (decimalPointIndex > 0 && decimalPointIndex % 2 == 1) ||
             (decimalPointIndex < 0 && decimalPointIndex % 2 == -1);
@@ -501,7 +507,7 @@ int dpiDataBuffer__toOracleNumberFromText(dpiDataBuffer *data, dpiEnv *env,
     // value for zero is a special case
     if (numDigits == 0) {
         *target = 128;
-        return DPI_SUCCESS;
+        return;
     }
 
     // calculate the exponent
@@ -529,7 +535,103 @@ int dpiDataBuffer__toOracleNumberFromText(dpiDataBuffer *data, dpiEnv *env,
     // than the maximum allowable
     if (appendSentinel)
         *target = 102;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiDataBuffer__toOracleNumberFromDouble() [INTERNAL]
+//   Populate the data in an OCINumber structure from a double. The shortest
+// sequence of digits (up to 17) which converts back to the same double is
+// used. Infinity and values outside the range supported by Oracle numbers
+// are passed to OCI, which raises the appropriate error or converts to zero.
+//-----------------------------------------------------------------------------
+int dpiDataBuffer__toOracleNumberFromDouble(dpiDataBuffer *data,
+        dpiError *error, void *oracleValue)
+{
+    uint8_t numDigits = 0, digits[24];
+    int precision, isNegative;
+    int16_t decimalPointIndex;
+    char buffer[40], *ptr;
+    double value;
 
+    // handle special cases
+    value = data->asDouble;
+    if (isnan(value))
+        return dpiError__set(error, "convert double to Oracle number",
+                DPI_ERR_NAN);
+    if (value == 0) {
+        dpiDataBuffer__toOracleNumberFromDigits(0, 0, 0, digits, oracleValue);
+        return DPI_SUCCESS;
+    }
+    if (value - value != 0)
+        return dpiOci__numberFromReal(value, oracleValue, error);
+
+    // determine the shortest representation that converts back to the same
+    // value; any value with 15 or fewer significant digits is found with the
+    // first attempt
+    for (precision = 15; precision < 17; precision++) {
+        (void) sprintf(buffer, "%.*e", precision - 1, value);
+        if (strtod(buffer, NULL) == value)
+            break;
+    }
+    if (precision == 17)
+        (void) sprintf(buffer, "%.*e", precision - 1, value);
+
+    // parse the digits and the exponent; anything other than a digit before
+    // the exponent (sign and decimal point) is skipped
+    ptr = buffer;
+    isNegative = (*ptr == '-');
+    for (; *ptr != 'e' && *ptr != 'E'; ptr++) {
+        if (*ptr >= '0' && *ptr <= '9')
+            digits[numDigits++] = (uint8_t) (*ptr - '0');
+    }
+    decimalPointIndex = (int16_t) (atoi(ptr + 1) + 1);
+    while (numDigits > 0 && digits[numDigits - 1] == 0)
+        numDigits--;
+    if (decimalPointIndex > 126 || decimalPointIndex < -129)
+        return dpiOci__numberFromReal(value, oracleValue, error);
+
+    dpiDataBuffer__toOracleNumberFromDigits(isNegative, decimalPointIndex,
+            numDigits, digits, oracleValue);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiDataBuffer__toOracleNumberFromInteger() [INTERNAL]
+//   Populate the data in an OCINumber structure from an integer.
+//-----------------------------------------------------------------------------
+int dpiDataBuffer__toOracleNumberFromInteger(dpiDataBuffer *data,
+        UNUSED dpiError *error, void *oracleValue)
+{
+    if (data->asInt64 < 0)
+        dpiDataBuffer__toOracleNumberFromAbsInteger(
+                (uint64_t) -(data->asInt64 + 1) + 1, 1, oracleValue);
+    else dpiDataBuffer__toOracleNumberFromAbsInteger(
+            (uint64_t) data->asInt64, 0, oracleValue);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiDataBuffer__toOracleNumberFromText() [INTERNAL]
+//   Populate the data in an OCINumber structure from text.
+//-----------------------------------------------------------------------------
+int dpiDataBuffer__toOracleNumberFromText(dpiDataBuffer *data, dpiEnv *env,
+        dpiError *error, void *oracleValue)
+{
+    uint8_t numDigits, digits[DPI_NUMBER_AS_TEXT_CHARS];
+    dpiBytes *value = &data->asBytes;
+    int16_t decimalPointIndex;
+    int isNegative;
+
+    // parse the string into its constituent components
+    if (dpiUtils__parseNumberString(value->ptr, value->length, env->charsetId,
+            &isNegative, &decimalPointIndex, &numDigits, digits, error) < 0)
+        return DPI_FAILURE;
+
+    dpiDataBuffer__toOracleNumberFromDigits(isNegative, decimalPointIndex,
+            numDigits, digits, oracleValue);
     return DPI_SUCCESS;
 }
 
@@ -539,10 +641,11 @@ int dpiDataBuffer__toOracleNumberFromText(dpiDataBuffer *data, dpiEnv *env,
 //   Populate the data in an OCINumber structure from an integer.
 //-----------------------------------------------------------------------------
 int dpiDataBuffer__toOracleNumberFromUnsignedInteger(dpiDataBuffer *data,
-        dpiError *error, void *oracleValue)
+        UNUSED dpiError *error, void *oracleValue)
 {
-    return dpiOci__numberFromInt(&data->asUint64, sizeof(uint64_t),
-            DPI_OCI_NUMBER_UNSIGNED, oracleValue, error);
+    dpiDataBuffer__toOracleNumberFromAbsInteger(data->asUint64, 0,
+            oracleValue);
+    return DPI_SUCCESS;
 }
 
 
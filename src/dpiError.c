@@ -123,7 +123,9 @@ int dpiError__set(dpiError *error, const char *action, dpiErrorNum errorNum,
 //   Called when an OCI error has occurred and sets the error structure with
 // the contents of that error. Note that trailing newlines and spaces are
 // truncated from the message if they exist. If the connection is not NULL a
-// check is made to see if the connection is no longer viable. The value
+// check is made to see if the connection is no longer viable. A call that is
+// still executing on a connection in non-blocking mode is reported with the
+// error DPI_ERR_STILL_EXECUTING so the caller can call again. The value
 // DPI_FAILURE is returned as a convenience to the caller, except when the
 // status of the call is DPI_OCI_SUCCESS_WITH_INFO, which is treated as a
 // successful call.
@@ -140,6 +142,8 @@ int dpiError__setFromOCI(dpiError *error, int status, dpiConn *conn,
         return DPI_FAILURE;
     else if (!error->handle)
         return dpiError__set(error, action, DPI_ERR_ERR_NOT_INITIALIZED);
+    else if (status == DPI_OCI_STILL_EXECUTING)
+        return dpiError__set(error, action, DPI_ERR_STILL_EXECUTING);
     else if (status != DPI_OCI_ERROR && status != DPI_OCI_NO_DATA &&
             status != DPI_OCI_SUCCESS_WITH_INFO)
         return dpiError__set(error, action,
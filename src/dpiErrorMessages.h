@@ -115,4 +115,15 @@ static const char* const dpiErrorMessages[DPI_ERR_MAX - DPI_ERR_NO_ERR] = {
     "DPI-1086: SODA document does not have JSON content. Call dpiJson_getContent() instead.", // DPI_ERR_SODA_DOC_IS_NOT_JSON
     "DPI-1087: not a query", // DPI_ERR_NOT_A_QUERY
     "DPI-1088: parameter %s size of %u is too large (max %u)", // DPI_ERR_PARAM_SIZE_TOO_LARGE
+    "DPI-1090: call is still executing. Call the function again with the same parameters to continue", // DPI_ERR_STILL_EXECUTING
+    "DPI-1091: LOB reader was already closed", // DPI_ERR_LOB_READER_CLOSED
+    "DPI-1092: LOB can only be copied to a connection acquired from the same pool", // DPI_ERR_LOB_COPY_WRONG_ENV
+    "DPI-1093: temporary LOBs cannot be copied to a different connection", // DPI_ERR_LOB_COPY_TEMPORARY
+    "DPI-1094: OSON data is invalid or not supported at offset %u", // DPI_ERR_INVALID_OSON
+    "DPI-1095: JSON path is invalid at position %u", // DPI_ERR_INVALID_JSON_PATH
+    "DPI-1096: column offsets must not decrease (value %u)", // DPI_ERR_INVALID_COLUMN_OFFSETS
+    "DPI-1097: Arrow format \"%s\" of column %u is not supported", // DPI_ERR_ARROW_FORMAT_NOT_SUPPORTED
+    "DPI-1098: Arrow array is invalid or does not match its schema at column %u", // DPI_ERR_INVALID_ARROW_ARRAY
+    "DPI-1099: vectors have different numbers of dimensions (%u and %u)", // DPI_ERR_VECTOR_DIMENSIONS_MISMATCH
+    "DPI-1100: distance metric %u is not supported for vectors of format %u and %u", // DPI_ERR_VECTOR_DISTANCE_NOT_SUPPORTED
 };
@@ -164,6 +164,12 @@ static const dpiTypeDef dpiAllTypeDefs[DPI_HTYPE_MAX - DPI_HTYPE_NONE - 1] = {
         sizeof(dpiVector),              // size of structure
         0x6c3dd6e9,                     // check integer
         (dpiTypeFreeProc) dpiVector__free
+    },
+    {
+        "dpiLobReader",                 // name
+        sizeof(dpiLobReader),           // size of structure
+        0x7e3a91c4,                     // check integer
+        (dpiTypeFreeProc) dpiLobReader__free
     }
 };
 
@@ -44,6 +44,7 @@
 #define _CRT_SECURE_NO_WARNINGS 1
 #endif
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
@@ -112,6 +113,10 @@ extern unsigned long dpiDebugLevel;
 // define internal chunk size used for dynamic binding/fetching
 #define DPI_DYNAMIC_BYTES_CHUNK_SIZE                65536
 
+// define amount of LOB data (in bytes or characters) prefetched when LOBs are
+// fetched as bytes; larger values are read after the fetch is complete
+#define DPI_LOB_PREFETCH_SIZE                       32768
+
 // define maximum buffer size permitted in variables
 #define DPI_MAX_VAR_BUFFER_SIZE                     (1024 * 1024 * 1024 - 2)
 
@@ -189,6 +194,7 @@ extern unsigned long dpiDebugLevel;
 // define values used for getting/setting OCI attributes
 #define DPI_OCI_ATTR_DATA_SIZE                      1
 #define DPI_OCI_ATTR_DATA_TYPE                      2
+#define DPI_OCI_ATTR_NONBLOCKING_MODE               3
 #define DPI_OCI_ATTR_ENV                            5
 #define DPI_OCI_ATTR_PRECISION                      5
 #define DPI_OCI_ATTR_SCALE                          6
@@ -313,6 +319,7 @@ extern unsigned long dpiDebugLevel;
 #define DPI_OCI_ATTR_CONNECTION_CLASS               425
 #define DPI_OCI_ATTR_PURITY                         426
 #define DPI_OCI_ATTR_RECEIVE_TIMEOUT                436
+#define DPI_OCI_ATTR_LOBPREFETCH_SIZE               439
 #define DPI_OCI_ATTR_LOBPREFETCH_LENGTH             440
 #define DPI_OCI_ATTR_SUBSCR_IPADDR                  452
 #define DPI_OCI_ATTR_UB8_ROW_COUNT                  457
@@ -514,8 +521,47 @@ extern unsigned long dpiDebugLevel;
 #define DPI_JZN_ALLOW_SCALAR_DOCUMENTS              0x00000080
 #define DPI_JZN_INPUT_UTF8                          1
 
+// define OSON (binary JSON) header constants
+#define DPI_OSON_MAGIC_BYTE_1                       0xff
+#define DPI_OSON_MAGIC_BYTE_2                       0x4a
+#define DPI_OSON_MAGIC_BYTE_3                       0x5a
+#define DPI_OSON_VERSION_MAX_FNAME_255              1
+#define DPI_OSON_VERSION_MAX_FNAME_65535            3
+#define DPI_OSON_FLAG_REL_OFFSET_MODE               0x0001
+#define DPI_OSON_FLAG_NUM_FNAMES_UINT32             0x0008
+#define DPI_OSON_FLAG_IS_SCALAR                     0x0010
+#define DPI_OSON_FLAG_SEC_FNAMES_SEG_UINT16         0x0100
+#define DPI_OSON_FLAG_NUM_FNAMES_UINT16             0x0400
+#define DPI_OSON_FLAG_FNAMES_SEG_UINT32             0x0800
+#define DPI_OSON_FLAG_TREE_SEG_UINT32               0x1000
+#define DPI_OSON_MAX_DEPTH                          1000
+
+// define OSON (binary JSON) node type constants
+#define DPI_OSON_TYPE_VECTOR                        0x01
+#define DPI_OSON_TYPE_NULL                          0x30
+#define DPI_OSON_TYPE_TRUE                          0x31
+#define DPI_OSON_TYPE_FALSE                         0x32
+#define DPI_OSON_TYPE_STRING_LENGTH_UINT8           0x33
+#define DPI_OSON_TYPE_NUMBER_LENGTH_UINT8           0x34
+#define DPI_OSON_TYPE_DECIMAL_LENGTH_UINT8          0x35
+#define DPI_OSON_TYPE_BINARY_DOUBLE                 0x36
+#define DPI_OSON_TYPE_STRING_LENGTH_UINT16          0x37
+#define DPI_OSON_TYPE_STRING_LENGTH_UINT32          0x38
+#define DPI_OSON_TYPE_TIMESTAMP                     0x39
+#define DPI_OSON_TYPE_BINARY_LENGTH_UINT16          0x3a
+#define DPI_OSON_TYPE_BINARY_LENGTH_UINT32          0x3b
+#define DPI_OSON_TYPE_DATE                          0x3c
+#define DPI_OSON_TYPE_INTERVAL_YM                   0x3d
+#define DPI_OSON_TYPE_INTERVAL_DS                   0x3e
+#define DPI_OSON_TYPE_EXTENDED                      0x7b
+#define DPI_OSON_TYPE_TIMESTAMP_TZ                  0x7c
+#define DPI_OSON_TYPE_TIMESTAMP7                    0x7d
+#define DPI_OSON_TYPE_ID                            0x7e
+#define DPI_OSON_TYPE_BINARY_FLOAT                  0x7f
+
 // define miscellaneous OCI constants
 #define DPI_OCI_CONTINUE                            -24200
+#define DPI_OCI_STILL_EXECUTING                     -3123
 #define DPI_OCI_INVALID_HANDLE                      -2
 #define DPI_OCI_ERROR                               -1
 #define DPI_OCI_DEFAULT                             0
@@ -524,6 +570,7 @@ extern unsigned long dpiDebugLevel;
 #define DPI_OCI_ATTR_PURITY_DEFAULT                 0
 #define DPI_OCI_NUMBER_UNSIGNED                     0
 #define DPI_OCI_SUCCESS_WITH_INFO                   1
+#define DPI_OCI_FIRST_PIECE                         1
 #define DPI_OCI_NTV_SYNTAX                          1
 #define DPI_OCI_MEMORY_CLEARED                      1
 #define DPI_OCI_SESSRLS_DROPSESS                    1
@@ -536,6 +583,7 @@ extern unsigned long dpiDebugLevel;
 #define DPI_OCI_LOB_READONLY                        1
 #define DPI_OCI_JSON_FORMAT_OSON                    1
 #define DPI_OCI_TEMP_CLOB                           2
+#define DPI_OCI_NEXT_PIECE                          2
 #define DPI_OCI_CRED_EXT                            2
 #define DPI_OCI_LOB_READWRITE                       2
 #define DPI_OCI_DATA_AT_EXEC                        2
@@ -683,6 +731,17 @@ typedef enum {
     DPI_ERR_SODA_DOC_IS_NOT_JSON,
     DPI_ERR_NOT_A_QUERY,
     DPI_ERR_PARAM_SIZE_TOO_LARGE,
+    DPI_ERR_STILL_EXECUTING,
+    DPI_ERR_LOB_READER_CLOSED,
+    DPI_ERR_LOB_COPY_WRONG_ENV,
+    DPI_ERR_LOB_COPY_TEMPORARY,
+    DPI_ERR_INVALID_OSON,
+    DPI_ERR_INVALID_JSON_PATH,
+    DPI_ERR_INVALID_COLUMN_OFFSETS,
+    DPI_ERR_ARROW_FORMAT_NOT_SUPPORTED,
+    DPI_ERR_INVALID_ARROW_ARRAY,
+    DPI_ERR_VECTOR_DIMENSIONS_MISMATCH,
+    DPI_ERR_VECTOR_DISTANCE_NOT_SUPPORTED,
     DPI_ERR_MAX
 } dpiErrorNum;
 
@@ -711,6 +770,7 @@ typedef enum {
     DPI_HTYPE_QUEUE,
     DPI_HTYPE_JSON,
     DPI_HTYPE_VECTOR,
+    DPI_HTYPE_LOB_READER,
     DPI_HTYPE_MAX
 } dpiHandleTypeNum;
 
@@ -1232,6 +1292,8 @@ typedef struct {
     dpiDynamicBytes *dynamicBytes;      // array of dynamically alloced chunks
     char *tempBuffer;                   // buffer for numeric conversion
     dpiData *externalData;              // array of buffers (externally used)
+    dpiData *lastSetData;               // copy of values last transferred
+    uint8_t *lastSetDataIsValid;        // array of flags (copy is valid?)
     dpiOracleData data;                 // Oracle data buffers (internal only)
 } dpiVarBuffer;
 
@@ -1247,6 +1309,24 @@ typedef struct {
     void **msgIds;                      // array of OCI message ids
 } dpiQueueBuffer;
 
+// represents the state of the decoding of OSON (the binary format used for
+// JSON) directly into native nodes
+typedef struct {
+    dpiJson *json;                      // JSON value which owns the nodes
+    const uint8_t *data;                // OSON data being decoded
+    uint32_t dataLength;                // length of OSON data
+    uint32_t pos;                       // current position in OSON data
+    uint32_t treeSegPos;                // position of tree segment
+    uint32_t fieldIdLength;             // size of field ids, in bytes
+    int relativeOffsets;                // child offsets relative to parent?
+    uint32_t numFieldNames;             // number of field names
+    const char **fieldNames;            // array of field names
+    uint32_t *fieldNameLengths;         // array of field name lengths
+    uint32_t options;                   // dpiJsonOptions value
+    uint32_t depth;                     // nesting depth of current node
+    uint32_t numNodes;                  // number of nodes decoded so far
+} dpiOsonDecoder;
+
 
 //-----------------------------------------------------------------------------
 // External implementation type definitions
@@ -1294,12 +1374,14 @@ struct dpiConn {
     uint16_t charsetId;                 // database character set ID
     dpiHandleList *openStmts;           // list of statements created
     dpiHandleList *openLobs;            // list of LOBs created
+    dpiHandleList *openQueues;          // list of queues created
     dpiHandleList *objects;             // list of objects created
     int externalHandle;                 // OCI handle provided directly?
     int deadSession;                    // dead session (drop from pool)?
     int standalone;                     // standalone connection (not pooled)?
     int creating;                       // connection is being created?
     int closing;                        // connection is being closed?
+    int nonBlocking;                    // non-blocking mode enabled?
 };
 
 // represents the context in which all activity in the library takes place; the
@@ -1348,6 +1430,8 @@ struct dpiStmt {
     int deleteFromCache;                // drop from statement cache on close?
     int closing;                        // statement is being closed?
     int externalHandle;                 // is external handle attached?
+    int executePending;                 // non-blocking execute in progress?
+    int fetchPending;                   // non-blocking fetch in progress?
     char sqlId[13];                     // SQL_ID (from v$SQL)
     uint32_t sqlIdLength;               // length of the sqlId
 };
@@ -1379,10 +1463,15 @@ struct dpiJson {
     void *handle;                       // OCI JSON descriptor
     dpiJsonNode topNode;                // top level node
     dpiDataBuffer topNodeBuffer;        // top level node data buffer
-    char **tempBuffers;                 // array of temp buffers
-    uint32_t allocatedTempBuffers;      // allocated number of temp buffers
-    uint32_t numTempBuffers;            // used number of temp buffers
-    uint32_t tempBufferUsed;            // used size of current temp buffer
+    char **arenaChunks;                 // chunks of memory for native nodes
+    uint32_t allocatedArenaChunks;      // allocated number of chunks
+    uint32_t numArenaChunks;            // used number of chunks
+    size_t arenaChunkSize;              // size of current chunk
+    size_t arenaChunkUsed;              // used size of current chunk
+    size_t arenaTotalUsed;              // used size of all chunks
+    char *textBuffer;                   // buffer for serialized JSON text
+    size_t textBufferSize;              // allocated size of text buffer
+    size_t textBufferLength;            // used size of text buffer
     void *convTimestamp;                // timestamp (for conversions)
     void *convIntervalDS;               // interval DS (for conversions)
     void *convIntervalYM;               // interval YM (for conversions)
@@ -1472,6 +1561,14 @@ struct dpiSubscr {
     void *callbackContext;              // context pointer for callback
     int clientInitiated;                // client initiated?
     int registered;                     // registered with database?
+    dpiSubscrMessage **queue;           // queued messages (circular buffer)
+    uint32_t maxQueuedMessages;         // size of queue (0 = not queued)
+    uint32_t queueStart;                // index of oldest queued message
+    uint32_t numQueuedMessages;         // number of messages in queue
+    uint64_t numDroppedMessages;        // messages discarded (queue full)
+    uint32_t coalesceWindow;            // window for merging messages (ms)
+    uint32_t coalesceRowThreshold;      // rows before collapsing to all rows
+    uint64_t lastQueuedTime;            // time newest message was queued
 };
 
 // represents the available options for dequeueing messages when using advanced
@@ -1504,6 +1601,7 @@ struct dpiMsgProps {
     void *payloadRaw;                   // payload (RAW)
     dpiJson *payloadJson;               // payload (JSON)
     void *msgIdRaw;                     // message ID (RAW)
+    dpiQueue *queue;                    // queue to recycle to (dequeued)
 };
 
 // represents SODA collections and is exposed publicly as a handle of type
@@ -1514,6 +1612,15 @@ struct dpiSodaColl {
     dpiSodaDb *db;                      // database which created this
     void *handle;                       // OCI SODA collection handle
     int binaryContent;                  // content stored in BLOB?
+    dpiMutexType insertBatchMutex;      // protects batch of documents
+    dpiSodaDoc **insertBatch;           // documents waiting to be inserted
+    void **insertBatchHandles;          // OCI handles of batched documents
+    uint32_t insertBatchNumDocs;        // number of documents in batch
+    uint32_t insertBatchMaxDocs;        // batch size which triggers insert
+    uint32_t insertBatchFlags;          // flags used when inserting batch
+    uint64_t insertBatchTotalDocs;      // number of batched docs inserted
+    dpiSodaInsertCallback insertBatchCallback;  // called after each insert
+    void *insertBatchCallbackContext;   // context passed to callback
 };
 
 // represents cursors that iterate over SODA collections and is exposed
@@ -1564,7 +1671,20 @@ struct dpiQueue {
     dpiDeqOptions *deqOptions;          // dequeue options
     dpiEnqOptions *enqOptions;          // enqueue options
     dpiQueueBuffer buffer;              // buffer area
+    dpiMutexType mutex;                 // protects buffer and batch
     int isJson;                         // is JSON payload?
+    dpiMsgProps **recycledProps;        // released props available for reuse
+    uint32_t numRecycledProps;          // number of recycled props
+    uint32_t maxRecycledProps;          // max number of recycled props
+    uint32_t openSlotNum;               // slot in connection handle list
+    int deqPending;                     // dequeue still executing?
+    uint32_t deqPendingNumProps;        // number of props being dequeued
+    uint32_t deqPendingPos;             // position of pending single dequeue
+    dpiMsgProps **enqBatch;             // messages waiting to be enqueued
+    uint32_t enqBatchNumProps;          // number of messages in batch
+    uint32_t enqBatchMaxMessages;       // batch size which triggers enqueue
+    uint32_t enqBatchMaxDelay;          // batch age which triggers enqueue
+    uint64_t enqBatchStartTime;         // time first message was batched
 };
 
 // represents vector values and is exposed publicly as a handle of type
@@ -1583,6 +1703,24 @@ struct dpiVector {
     void *dimensions;                   // array of vector dimensions
 };
 
+// represents a stream of the contents of a LOB and is exposed publicly as a
+// handle of type DPI_HTYPE_LOB_READER; the implementation for this is found in
+// the file dpiLobReader.c; the LOB is read in polling mode so that the
+// database streams the contents of the LOB without waiting for each piece to
+// be requested
+struct dpiLobReader {
+    dpiType_HEAD
+    dpiLob *lob;                        // LOB being read
+    uint64_t offset;                    // offset at which to start reading
+    uint64_t amount;                    // amount to read (0 for all)
+    char *buffer;                       // buffer for each piece read
+    uint64_t bufferSize;                // size of buffer, in bytes
+    uint64_t numBytesRead;              // total bytes read so far
+    int started;                        // has the first piece been read?
+    int finished;                       // has the last piece been read?
+    int openedFile;                     // was BFILE opened by the reader?
+};
+
 
 //-----------------------------------------------------------------------------
 // definition of internal dpiContext methods
@@ -1592,7 +1730,8 @@ void dpiContext__initCommonCreateParams(const dpiContext *context,
 void dpiContext__initConnCreateParams(dpiConnCreateParams *params);
 void dpiContext__initPoolCreateParams(dpiPoolCreateParams *params);
 void dpiContext__initSodaOperOptions(dpiSodaOperOptions *options);
-void dpiContext__initSubscrCreateParams(dpiSubscrCreateParams *params);
+void dpiContext__initSubscrCreateParams(const dpiContext *context,
+        dpiSubscrCreateParams *params);
 
 
 //-----------------------------------------------------------------------------
@@ -1765,8 +1904,11 @@ int32_t dpiVar__inBindCallback(dpiVar *var, void *bindp, uint32_t iter,
         void **indpp);
 int dpiVar__getValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
         int inFetch, dpiError *error);
+int dpiVar__setFromBytes(dpiVar *var, uint32_t pos, const char *value,
+        uint32_t valueLength, dpiError *error);
 int dpiVar__setValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
         dpiData *data, dpiError *error);
+int dpiVar__setValueIfChanged(dpiVar *var, uint32_t pos, dpiError *error);
 int32_t dpiVar__outBindCallback(dpiVar *var, void *bindp, uint32_t iter,
         uint32_t index, void **bufpp, uint32_t **alenpp, uint8_t *piecep,
         void **indpp, uint16_t **rcodepp);
@@ -1777,11 +1919,24 @@ int32_t dpiVar__outBindCallback(dpiVar *var, void *bindp, uint32_t iter,
 //-----------------------------------------------------------------------------
 int dpiJson__allocate(dpiConn *conn, void *handle, dpiJson **json,
         dpiError *error);
+int dpiJson__allocateFromArena(dpiJson *json, size_t size, void **ptr,
+        dpiError *error);
 void dpiJson__free(dpiJson *json, dpiError *error);
+int dpiJson__getValue(dpiJson *json, uint32_t options, dpiError *error);
+void dpiJson__resetArena(dpiJson *json);
+int dpiJsonNode__fromOracleNumberAsText(dpiJson *json, dpiJsonNode *node,
+        uint8_t *numBuffer, dpiError *error);
 int dpiJson__setValue(dpiJson *json, const dpiJsonNode *topNode,
         dpiError *error);
 
 
+//-----------------------------------------------------------------------------
+// definition of internal dpiJsonText methods
+//-----------------------------------------------------------------------------
+int dpiJsonText__serialize(dpiJson *json, const dpiJsonNode *node,
+        dpiError *error);
+
+
 //-----------------------------------------------------------------------------
 // definition of internal dpiLob methods
 //-----------------------------------------------------------------------------
@@ -1873,6 +2028,13 @@ void dpiSodaCollCursor__free(dpiSodaCollCursor *cursor, dpiError *error);
 //-----------------------------------------------------------------------------
 // definition of internal dpiSodaDb methods
 //-----------------------------------------------------------------------------
+int dpiSodaDb__createDocument(dpiSodaDb *db, const char *key,
+        uint32_t keyLength, const char *content, uint32_t contentLength,
+        const char *mediaType, uint32_t mediaTypeLength, dpiSodaDoc **doc,
+        dpiError *error);
+int dpiSodaDb__createJsonDocument(dpiSodaDb *db, const char *key,
+        uint32_t keyLength, const dpiJsonNode *content, dpiSodaDoc **doc,
+        dpiError *error);
 void dpiSodaDb__free(dpiSodaDb *db, dpiError *error);
 
 
@@ -1899,15 +2061,47 @@ int dpiQueue__allocate(dpiConn *conn, const char *name, uint32_t nameLength,
         dpiObjectType *payloadType, dpiQueue **queue, int isJson,
         dpiError *error);
 void dpiQueue__free(dpiQueue *queue, dpiError *error);
+int dpiQueue__recycleMsgProps(dpiQueue *queue, dpiMsgProps *props,
+        dpiError *error);
 
 
 //-----------------------------------------------------------------------------
 // definition of internal dpiVector methods
 //-----------------------------------------------------------------------------
 int dpiVector__allocate(dpiConn *conn, dpiVector **vector, dpiError *error);
+void dpiVector__clearDimensions(dpiVector *vector);
+int dpiVector__copyToBuffer(dpiVector *vector, uint8_t format,
+        uint32_t numDimensions, void *buffer, dpiError *error);
 void dpiVector__free(dpiVector *vector, dpiError *error);
 
 
+//-----------------------------------------------------------------------------
+// definition of internal dpiLobReader methods
+//-----------------------------------------------------------------------------
+int dpiLobReader__allocate(dpiLob *lob, uint64_t offset, uint64_t amount,
+        dpiLobReader **reader, dpiError *error);
+void dpiLobReader__free(dpiLobReader *reader, dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiOson methods
+//-----------------------------------------------------------------------------
+int dpiOson__decode(dpiJson *json, const char *data, uint64_t dataLength,
+        const char *path, uint32_t pathLength, uint32_t options,
+        dpiJsonNode **node, dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiArrow methods
+//-----------------------------------------------------------------------------
+int dpiArrow__newVar(dpiConn *conn, const struct ArrowSchema *schema,
+        const struct ArrowArray *array, uint32_t column,
+        uint32_t maxArraySize, dpiVar **var, dpiError *error);
+int dpiArrow__setVar(dpiVar *var, const struct ArrowSchema *schema,
+        const struct ArrowArray *array, uint32_t column, int64_t startRow,
+        uint32_t numRows, dpiError *error);
+
+
 //-----------------------------------------------------------------------------
 // definition of internal dpiOci methods
 //-----------------------------------------------------------------------------
@@ -2029,6 +2223,9 @@ int dpiOci__lobOpen(dpiLob *lob, dpiError *error);
 int dpiOci__lobRead2(dpiLob *lob, uint64_t offset, uint64_t *amountInBytes,
         uint64_t *amountInChars, char *buffer, uint64_t bufferLength,
         dpiError *error);
+int dpiOci__lobReadPiece(dpiLob *lob, uint64_t offset, uint8_t piece,
+        uint64_t *amountInBytes, uint64_t *amountInChars, char *buffer,
+        uint64_t bufferLength, int *moreData, dpiError *error);
 int dpiOci__lobTrim2(dpiLob *lob, uint64_t newLength, dpiError *error);
 int dpiOci__lobWrite2(dpiLob *lob, uint64_t offset, const char *value,
         uint64_t valueLength, dpiError *error);
@@ -2082,6 +2279,7 @@ int dpiOci__rawPtr(void *envHandle, void *handle, void **ptr);
 int dpiOci__rawResize(void *envHandle, void **handle, uint32_t newSize,
         dpiError *error);
 int dpiOci__rawSize(void *envHandle, void *handle, uint32_t *size);
+int dpiOci__reset(dpiConn *conn, dpiError *error);
 int dpiOci__rowidToChar(dpiRowid *rowid, char *buffer, uint16_t *bufferSize,
         dpiError *error);
 int dpiOci__serverAttach(dpiConn *conn, const char *connectString,
@@ -2222,7 +2420,8 @@ int dpiOci__vectorFromArray(dpiVector *vector, dpiVectorInfo *info,
         dpiError *error);
 int dpiOci__vectorFromSparseArray(dpiVector *vector, dpiVectorInfo *info,
         dpiError *error);
-int dpiOci__vectorToArray(dpiVector *vector, dpiError *error);
+int dpiOci__vectorToArray(dpiVector *vector, uint8_t format,
+        uint32_t *numDimensions, void *dimensions, dpiError *error);
 int dpiOci__vectorToSparseArray(dpiVector *vector, dpiError *error);
 
 
@@ -2286,6 +2485,7 @@ void dpiUtils__freeMemory(void *ptr);
 int dpiUtils__getAttrStringWithDup(const char *action, const void *ociHandle,
         uint32_t ociHandleType, uint32_t ociAttribute, const char **value,
         uint32_t *valueLength, dpiError *error);
+uint64_t dpiUtils__getMilliseconds(void);
 #ifdef _WIN32
 int dpiUtils__getWindowsError(DWORD errorNum, char **buffer,
         size_t *bufferLength, dpiError *error);
@@ -2296,6 +2496,8 @@ int dpiUtils__parseNumberString(const char *value, uint32_t valueLength,
 int dpiUtils__parseOracleNumber(void *oracleValue, int *isNegative,
         int16_t *decimalPointIndex, uint8_t *numDigits, uint8_t *digits,
         dpiError *error);
+int dpiUtils__reallocateMemory(size_t size, const char *action, void **ptr,
+        dpiError *error);
 int dpiUtils__setAttributesFromCommonCreateParams(void *handle,
         uint32_t handleType, const dpiCommonCreateParams *params,
         dpiError *error);
@@ -32,9 +32,10 @@
 // define number of nodes which are processed in each batch
 #define DPI_JSON_BATCH_NODES            64
 
-// define batch size of space allocated for temporary buffers used for
-// converting numbers to text
-#define DPI_JSON_TEMP_BUFFER_SIZE       1024
+// define minimum size of the chunks of memory allocated for the arena used
+// for the native nodes and the alignment of each allocation from the arena
+#define DPI_JSON_ARENA_MIN_CHUNK_SIZE   8192
+#define DPI_JSON_ARENA_ALIGNMENT        8
 
 // forward declarations of internal functions only used in this file
 static int dpiJsonNode__fromOracleArrayToNative(dpiJson *json,
@@ -89,6 +90,67 @@ int dpiJson__allocate(dpiConn *conn, void *handle, dpiJson **json,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiJson__allocateFromArena() [INTERNAL]
+//   Allocate memory for the native nodes from the arena. Memory is bump
+// allocated from the current chunk; if there is insufficient space remaining,
+// a new chunk is allocated which is at least twice the size of the previous
+// one. The memory is not initialized and remains valid until the arena is
+// reset.
+//-----------------------------------------------------------------------------
+int dpiJson__allocateFromArena(dpiJson *json, size_t size, void **ptr,
+        dpiError *error)
+{
+    size_t chunkSize;
+    char **tempChunks;
+
+    // all allocations are aligned so that any structure can be stored
+    size = (size + DPI_JSON_ARENA_ALIGNMENT - 1) &
+            ~((size_t) DPI_JSON_ARENA_ALIGNMENT - 1);
+
+    // if there is no room in the current chunk, allocate a new one
+    if (json->numArenaChunks == 0 ||
+            json->arenaChunkUsed + size > json->arenaChunkSize) {
+
+        // if no room is available in the chunk array, increase its size
+        if (json->numArenaChunks == json->allocatedArenaChunks) {
+            if (dpiUtils__allocateMemory(json->allocatedArenaChunks + 8,
+                    sizeof(char*), 0, "allocate JSON arena chunk array",
+                    (void**) &tempChunks, error) < 0)
+                return DPI_FAILURE;
+            if (json->numArenaChunks > 0) {
+                memcpy(tempChunks, json->arenaChunks,
+                        json->numArenaChunks * sizeof(char*));
+                dpiUtils__freeMemory(json->arenaChunks);
+            }
+            json->arenaChunks = tempChunks;
+            json->allocatedArenaChunks += 8;
+        }
+
+        // allocate a new chunk
+        chunkSize = json->arenaChunkSize * 2;
+        if (chunkSize < DPI_JSON_ARENA_MIN_CHUNK_SIZE)
+            chunkSize = DPI_JSON_ARENA_MIN_CHUNK_SIZE;
+        if (chunkSize < size)
+            chunkSize = size;
+        if (dpiUtils__allocateMemory(1, chunkSize, 0,
+                "allocate JSON arena chunk",
+                (void**) &json->arenaChunks[json->numArenaChunks],
+                error) < 0)
+            return DPI_FAILURE;
+        json->numArenaChunks++;
+        json->arenaChunkSize = chunkSize;
+        json->arenaChunkUsed = 0;
+
+    }
+
+    *ptr = json->arenaChunks[json->numArenaChunks - 1] + json->arenaChunkUsed;
+    json->arenaChunkUsed += size;
+    json->arenaTotalUsed += size;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiJsonNode__fromOracleArrayToNative() [INTERNAL]
 //   Populate an array node from the Oracle JSON node.
@@ -111,16 +173,18 @@ static int dpiJsonNode__fromOracleArrayToNative(dpiJson *json,
     array = &node->value->asJsonArray;
     array->numElements = (*domDoc->methods->fnGetArraySize)(domDoc,
             oracleNode);
+    array->elements = NULL;
+    array->elementValues = NULL;
     if (array->numElements == 0)
         return DPI_SUCCESS;
 
-    // allocate memory
-    if (dpiUtils__allocateMemory(array->numElements, sizeof(dpiJsonNode), 1,
-            "allocate JSON array element nodes", (void**) &array->elements,
-            error) < 0)
+    // allocate memory from the arena
+    if (dpiJson__allocateFromArena(json,
+            array->numElements * sizeof(dpiJsonNode),
+            (void**) &array->elements, error) < 0)
         return DPI_FAILURE;
-    if (dpiUtils__allocateMemory(array->numElements, sizeof(dpiDataBuffer), 1,
-            "allocate JSON array element values",
+    if (dpiJson__allocateFromArena(json,
+            array->numElements * sizeof(dpiDataBuffer),
             (void**) &array->elementValues, error) < 0)
         return DPI_FAILURE;
 
@@ -165,25 +229,26 @@ static int dpiJsonNode__fromOracleObjectToNative(dpiJson *json,
     // object, nothing further needs to be done at this point
     obj = &node->value->asJsonObject;
     obj->numFields = (*domDoc->methods->fnGetNumObjField)(domDoc, oracleNode);
+    obj->fieldNames = NULL;
+    obj->fieldNameLengths = NULL;
+    obj->fields = NULL;
+    obj->fieldValues = NULL;
     if (obj->numFields == 0)
         return DPI_SUCCESS;
 
-    // allocate memory
-    if (dpiUtils__allocateMemory(obj->numFields, sizeof(char*), 1,
-            "allocate JSON object field names", (void**) &obj->fieldNames,
-            error) < 0)
+    // allocate memory from the arena
+    if (dpiJson__allocateFromArena(json, obj->numFields * sizeof(char*),
+            (void**) &obj->fieldNames, error) < 0)
         return DPI_FAILURE;
-    if (dpiUtils__allocateMemory(obj->numFields, sizeof(uint32_t), 1,
-            "allocate JSON object field name lengths",
+    if (dpiJson__allocateFromArena(json, obj->numFields * sizeof(uint32_t),
             (void**) &obj->fieldNameLengths, error) < 0)
         return DPI_FAILURE;
-    if (dpiUtils__allocateMemory(obj->numFields, sizeof(dpiJsonNode), 1,
-            "allocate JSON object field nodes", (void**) &obj->fields,
-            error) < 0)
+    if (dpiJson__allocateFromArena(json, obj->numFields * sizeof(dpiJsonNode),
+            (void**) &obj->fields, error) < 0)
         return DPI_FAILURE;
-    if (dpiUtils__allocateMemory(obj->numFields, sizeof(dpiDataBuffer), 1,
-            "allocate JSON object field values", (void**) &obj->fieldValues,
-            error) < 0)
+    if (dpiJson__allocateFromArena(json,
+            obj->numFields * sizeof(dpiDataBuffer),
+            (void**) &obj->fieldValues, error) < 0)
         return DPI_FAILURE;
 
     // process all of the nodes in the object in batches
@@ -209,52 +274,33 @@ static int dpiJsonNode__fromOracleObjectToNative(dpiJson *json,
 
 //-----------------------------------------------------------------------------
 // dpiJsonNode__fromOracleNumberAsText() [INTERNAL]
-//   Populate a scalar number as a text buffer. Temporary buffers are allocated
-// as needed and an array of these are stored in the JSON object. Each
-// temporary buffer contains as many numbers as can be fit before a new
-// temporary buffer is allocated.
+//   Populate a scalar number as a text buffer. Space for the largest possible
+// number is allocated from the arena and the unused portion is returned to
+// the arena after the conversion has taken place.
 //-----------------------------------------------------------------------------
-static int dpiJsonNode__fromOracleNumberAsText(dpiJson *json,
+int dpiJsonNode__fromOracleNumberAsText(dpiJson *json,
         dpiJsonNode *node, uint8_t *numBuffer, dpiError *error)
 {
-    char **tempBuffers;
-
-    // if there is no room in the current temporary buffer, allocate a new one
-    if (json->tempBufferUsed + DPI_NUMBER_AS_TEXT_CHARS <
-            DPI_JSON_TEMP_BUFFER_SIZE) {
-
-        // if no room is available in the temp buffer array, increase the size
-        // of the array
-        if (json->numTempBuffers == json->allocatedTempBuffers) {
-            json->allocatedTempBuffers += 16;
-            if (dpiUtils__allocateMemory(json->allocatedTempBuffers,
-                    sizeof(char*), 0, "allocate JSON temp buffer array",
-                    (void**) &tempBuffers, error) < 0)
-                return DPI_FAILURE;
-            if (json->numTempBuffers > 0) {
-                memcpy(tempBuffers, json->tempBuffers,
-                        json->numTempBuffers * sizeof(char*));
-                dpiUtils__freeMemory(json->tempBuffers);
-            }
-            json->tempBuffers = tempBuffers;
-        }
-
-        // allocate a new temporary buffer
-        if (dpiUtils__allocateMemory(1, DPI_JSON_TEMP_BUFFER_SIZE, 0,
-                "allocate JSON temp buffer",
-                (void**) &json->tempBuffers[json->numTempBuffers], error) < 0)
-            return DPI_FAILURE;
-        json->numTempBuffers++;
-        json->tempBufferUsed = 0;
+    size_t unused;
 
-    }
+    // allocate space for the text from the arena
+    if (dpiJson__allocateFromArena(json, DPI_NUMBER_AS_TEXT_CHARS,
+            (void**) &node->value->asBytes.ptr, error) < 0)
+        return DPI_FAILURE;
 
     // perform the conversion
-    node->value->asBytes.ptr = json->tempBuffers[json->numTempBuffers - 1] +
-            json->tempBufferUsed;
     node->value->asBytes.length = DPI_NUMBER_AS_TEXT_CHARS;
-    return dpiDataBuffer__fromOracleNumberAsText(node->value, json->env,
-            error, numBuffer);
+    if (dpiDataBuffer__fromOracleNumberAsText(node->value, json->env,
+            error, numBuffer) < 0)
+        return DPI_FAILURE;
+
+    // return the unused space to the arena; the allocation is the most recent
+    // one so the remaining space is at the end of the current chunk
+    unused = (DPI_NUMBER_AS_TEXT_CHARS - node->value->asBytes.length) &
+            ~((size_t) DPI_JSON_ARENA_ALIGNMENT - 1);
+    json->arenaChunkUsed -= unused;
+    json->arenaTotalUsed -= unused;
+    return DPI_SUCCESS;
 }
 
 
@@ -661,6 +707,28 @@ static int dpiJsonNode__toOracleFromNative(dpiJson *json,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiJson__resetArena() [INTERNAL]
+//   Reset the arena so that the memory used by the native nodes can be reused.
+// If more than one chunk was required, the chunks are replaced by a single
+// chunk large enough to hold all of them so that the next conversion of a
+// similar value requires no further allocations.
+//-----------------------------------------------------------------------------
+void dpiJson__resetArena(dpiJson *json)
+{
+    uint32_t i;
+
+    if (json->numArenaChunks > 1) {
+        for (i = 0; i < json->numArenaChunks; i++)
+            dpiUtils__freeMemory(json->arenaChunks[i]);
+        json->numArenaChunks = 0;
+        json->arenaChunkSize = json->arenaTotalUsed / 2;
+    }
+    json->arenaChunkUsed = 0;
+    json->arenaTotalUsed = 0;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiJson__setValue() [INTERNAL]
 //   Sets the value of the JSON object, given a hierarchy of nodes.
@@ -700,56 +768,6 @@ int dpiJson__setValue(dpiJson *json, const dpiJsonNode *topNode,
 }
 
 
-//-----------------------------------------------------------------------------
-// dpiJsonNode__free() [INTERNAL]
-//   Free the buffers allocated for the JSON node.
-//-----------------------------------------------------------------------------
-static void dpiJsonNode__free(dpiJsonNode *node)
-{
-    dpiJsonArray *array;
-    dpiJsonObject *obj;
-    uint32_t i;
-
-    if (node->oracleTypeNum == DPI_ORACLE_TYPE_JSON_ARRAY) {
-        array = &node->value->asJsonArray;
-        if (array->elements) {
-            for (i = 0; i < array->numElements; i++) {
-                if (array->elements[i].value)
-                    dpiJsonNode__free(&array->elements[i]);
-            }
-            dpiUtils__freeMemory(array->elements);
-            array->elements = NULL;
-        }
-        if (array->elementValues) {
-            dpiUtils__freeMemory(array->elementValues);
-            array->elementValues = NULL;
-        }
-    } else if (node->oracleTypeNum == DPI_ORACLE_TYPE_JSON_OBJECT) {
-        obj = &node->value->asJsonObject;
-        if (obj->fields) {
-            for (i = 0; i < obj->numFields; i++) {
-                if (obj->fields[i].value)
-                    dpiJsonNode__free(&obj->fields[i]);
-            }
-            dpiUtils__freeMemory(obj->fields);
-            obj->fields = NULL;
-        }
-        if (obj->fieldNames) {
-            dpiUtils__freeMemory(obj->fieldNames);
-            obj->fieldNames = NULL;
-        }
-        if (obj->fieldNameLengths) {
-            dpiUtils__freeMemory(obj->fieldNameLengths);
-            obj->fieldNameLengths = NULL;
-        }
-        if (obj->fieldValues) {
-            dpiUtils__freeMemory(obj->fieldValues);
-            obj->fieldValues = NULL;
-        }
-    }
-}
-
-
 //-----------------------------------------------------------------------------
 // dpiJson__free() [INTERNAL]
 //   Free the buffers allocated for the JSON value and all of its nodes, if
@@ -767,11 +785,15 @@ void dpiJson__free(dpiJson *json, dpiError *error)
         dpiGen__setRefCount(json->conn, error, -1);
         json->conn = NULL;
     }
-    if (json->tempBuffers) {
-        for (i = 0; i < json->numTempBuffers; i++)
-            dpiUtils__freeMemory(json->tempBuffers[i]);
-        dpiUtils__freeMemory(json->tempBuffers);
-        json->tempBuffers = NULL;
+    if (json->arenaChunks) {
+        for (i = 0; i < json->numArenaChunks; i++)
+            dpiUtils__freeMemory(json->arenaChunks[i]);
+        dpiUtils__freeMemory(json->arenaChunks);
+        json->arenaChunks = NULL;
+    }
+    if (json->textBuffer) {
+        dpiUtils__freeMemory(json->textBuffer);
+        json->textBuffer = NULL;
     }
     if (json->convTimestamp) {
         dpiOci__descriptorFree(json->convTimestamp, DPI_OCI_DTYPE_TIMESTAMP);
@@ -787,11 +809,35 @@ void dpiJson__free(dpiJson *json, dpiError *error)
                 DPI_OCI_DTYPE_INTERVAL_YM);
         json->convIntervalYM = NULL;
     }
-    dpiJsonNode__free(&json->topNode);
     dpiUtils__freeMemory(json);
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiJson__getValue() [INTERNAL]
+//   Populate the top level node from the value of the JSON object.
+//-----------------------------------------------------------------------------
+int dpiJson__getValue(dpiJson *json, uint32_t options, dpiError *error)
+{
+    dpiJznDomDoc *domDoc;
+    void *oracleNode;
+
+    dpiJson__resetArena(json);
+    json->topNode.value = &json->topNodeBuffer;
+    json->topNode.oracleTypeNum = DPI_ORACLE_TYPE_NONE;
+    json->topNode.nativeTypeNum = DPI_NATIVE_TYPE_NULL;
+    if (dpiOci__jsonDomDocGet(json, &domDoc, error) < 0)
+        return DPI_FAILURE;
+    if (domDoc) {
+        oracleNode = (*domDoc->methods->fnGetRootNode)(domDoc);
+        if (dpiJsonNode__fromOracleToNative(json, &json->topNode, domDoc,
+                oracleNode, options, error) < 0)
+            return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiJson_addRef() [PUBLIC]
 //   Add a reference to the JSON object.
@@ -802,36 +848,76 @@ int dpiJson_addRef(dpiJson *json)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiJson_getText() [PUBLIC]
+//   Gets the value of the JSON object, or of the supplied node, as JSON text.
+// The text is stored in a buffer owned by the JSON object which is reused by
+// subsequent calls.
+//-----------------------------------------------------------------------------
+int dpiJson_getText(dpiJson *json, const dpiJsonNode *node,
+        const char **value, uint64_t *valueLength)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(json, DPI_HTYPE_JSON, __func__, &error) < 0)
+        return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(json, value)
+    DPI_CHECK_PTR_NOT_NULL(json, valueLength)
+    if (!node) {
+        if (dpiJson__getValue(json, DPI_JSON_OPT_NUMBER_AS_STRING,
+                &error) < 0)
+            return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
+        node = &json->topNode;
+    }
+    if (dpiJsonText__serialize(json, node, &error) < 0)
+        return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
+    *value = json->textBuffer;
+    *valueLength = json->textBufferLength;
+    return dpiGen__endPublicFn(json, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiJson_getValue() [PUBLIC]
 //   Gets the value of the JSON object as a hierarchy of nodes.
 //-----------------------------------------------------------------------------
 int dpiJson_getValue(dpiJson *json, uint32_t options, dpiJsonNode **topNode)
 {
-    dpiJznDomDoc *domDoc;
-    void *oracleNode;
     dpiError error;
 
     if (dpiGen__startPublicFn(json, DPI_HTYPE_JSON, __func__, &error) < 0)
         return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
-    dpiJsonNode__free(&json->topNode);
-    json->topNode.value = &json->topNodeBuffer;
-    json->topNode.oracleTypeNum = DPI_ORACLE_TYPE_NONE;
-    json->topNode.nativeTypeNum = DPI_NATIVE_TYPE_NULL;
-    if (dpiOci__jsonDomDocGet(json, &domDoc, &error) < 0)
+    if (dpiJson__getValue(json, options, &error) < 0)
         return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
-    if (domDoc) {
-        oracleNode = (*domDoc->methods->fnGetRootNode)(domDoc);
-        if (dpiJsonNode__fromOracleToNative(json, &json->topNode, domDoc,
-                oracleNode, options, &error) < 0)
-            return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
-    }
-
     *topNode = &json->topNode;
     return dpiGen__endPublicFn(json, DPI_SUCCESS, &error);
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiJson_getValueFromOson() [PUBLIC]
+//   Gets the value of the supplied OSON data as a hierarchy of nodes, without
+// the use of the OCI JSON DOM. If a path is supplied, only the node identified
+// by that path is decoded.
+//-----------------------------------------------------------------------------
+int dpiJson_getValueFromOson(dpiJson *json, const char *value,
+        uint64_t valueLength, const char *path, uint32_t pathLength,
+        uint32_t options, dpiJsonNode **node)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(json, DPI_HTYPE_JSON, __func__, &error) < 0)
+        return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(json, value)
+    DPI_CHECK_PTR_AND_LENGTH(json, path)
+    DPI_CHECK_PTR_NOT_NULL(json, node)
+    status = dpiOson__decode(json, value, valueLength, path, pathLength,
+            options, node, &error);
+    return dpiGen__endPublicFn(json, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiJson_release() [PUBLIC]
 //   Release a reference to the JSON object.
@@ -0,0 +1,472 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpiJsonText.c
+//   Implementation of serializing a hierarchy of native JSON nodes to JSON
+// text.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+// minimum size of the text buffer
+#define DPI_JSON_TEXT_MIN_BUFFER_SIZE   4096
+
+// constants used for scanning strings eight bytes at a time; a chunk requires
+// escaping if any of its bytes is a control character, a double quote or a
+// backslash
+#define DPI_JSON_TEXT_ONES              ((uint64_t) 0x0101010101010101)
+#define DPI_JSON_TEXT_HIGHS             ((uint64_t) 0x8080808080808080)
+#define DPI_JSON_TEXT_HAS_LESS(x, n) \
+        (((x) - DPI_JSON_TEXT_ONES * (n)) & ~(x) & DPI_JSON_TEXT_HIGHS)
+#define DPI_JSON_TEXT_HAS_ZERO(x) \
+        (((x) - DPI_JSON_TEXT_ONES) & ~(x) & DPI_JSON_TEXT_HIGHS)
+#define DPI_JSON_TEXT_NEEDS_ESCAPE(x) \
+        (DPI_JSON_TEXT_HAS_LESS(x, 0x20) | \
+         DPI_JSON_TEXT_HAS_ZERO((x) ^ (DPI_JSON_TEXT_ONES * '"')) | \
+         DPI_JSON_TEXT_HAS_ZERO((x) ^ (DPI_JSON_TEXT_ONES * '\\')))
+
+// hexadecimal digits used for escaping and for binary values
+static const char dpiJsonTextHexDigits[] = "0123456789abcdef";
+
+// forward declarations of internal functions only used in this file
+static int dpiJsonText__writeNode(dpiJson *json, const dpiJsonNode *node,
+        dpiError *error);
+static int dpiJsonText__writeObject(dpiJson *json, const dpiJsonObject *obj,
+        dpiError *error);
+static int dpiJsonText__writeString(dpiJson *json, const char *value,
+        uint32_t valueLength, dpiError *error);
+static int dpiJsonText__writeTimestamp(dpiJson *json,
+        dpiOracleTypeNum oracleTypeNum, const dpiTimestamp *value,
+        dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__ensureSpace() [INTERNAL]
+//   Ensure that the text buffer has space for at least the given number of
+// additional bytes. The buffer is doubled in size each time it must grow.
+//-----------------------------------------------------------------------------
+static int dpiJsonText__ensureSpace(dpiJson *json, size_t numBytes,
+        dpiError *error)
+{
+    size_t newSize;
+    char *tempBuffer;
+
+    if (json->textBufferLength + numBytes <= json->textBufferSize)
+        return DPI_SUCCESS;
+    newSize = json->textBufferSize * 2;
+    if (newSize < DPI_JSON_TEXT_MIN_BUFFER_SIZE)
+        newSize = DPI_JSON_TEXT_MIN_BUFFER_SIZE;
+    while (newSize < json->textBufferLength + numBytes)
+        newSize *= 2;
+    if (dpiUtils__allocateMemory(1, newSize, 0, "allocate JSON text buffer",
+            (void**) &tempBuffer, error) < 0)
+        return DPI_FAILURE;
+    if (json->textBuffer) {
+        memcpy(tempBuffer, json->textBuffer, json->textBufferLength);
+        dpiUtils__freeMemory(json->textBuffer);
+    }
+    json->textBuffer = tempBuffer;
+    json->textBufferSize = newSize;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__serialize() [INTERNAL]
+//   Serialize the node (and all of its children) to JSON text, which is
+// stored in the text buffer owned by the JSON value. The buffer is reused by
+// subsequent calls.
+//-----------------------------------------------------------------------------
+int dpiJsonText__serialize(dpiJson *json, const dpiJsonNode *node,
+        dpiError *error)
+{
+    json->textBufferLength = 0;
+    return dpiJsonText__writeNode(json, node, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__write() [INTERNAL]
+//   Append the given bytes to the text buffer.
+//-----------------------------------------------------------------------------
+static int dpiJsonText__write(dpiJson *json, const char *value,
+        size_t valueLength, dpiError *error)
+{
+    if (dpiJsonText__ensureSpace(json, valueLength, error) < 0)
+        return DPI_FAILURE;
+    memcpy(json->textBuffer + json->textBufferLength, value, valueLength);
+    json->textBufferLength += valueLength;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__writeArray() [INTERNAL]
+//   Write an array and all of its elements.
+//-----------------------------------------------------------------------------
+static int dpiJsonText__writeArray(dpiJson *json, const dpiJsonArray *array,
+        dpiError *error)
+{
+    uint32_t i;
+
+    if (dpiJsonText__write(json, "[", 1, error) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < array->numElements; i++) {
+        if (i > 0 && dpiJsonText__write(json, ",", 1, error) < 0)
+            return DPI_FAILURE;
+        if (dpiJsonText__writeNode(json, &array->elements[i], error) < 0)
+            return DPI_FAILURE;
+    }
+    return dpiJsonText__write(json, "]", 1, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__writeBinary() [INTERNAL]
+//   Write a binary value as a string containing hexadecimal digits.
+//-----------------------------------------------------------------------------
+static int dpiJsonText__writeBinary(dpiJson *json, const dpiBytes *bytes,
+        dpiError *error)
+{
+    const uint8_t *ptr = (const uint8_t*) bytes->ptr;
+    char *target;
+    uint32_t i;
+
+    if (dpiJsonText__ensureSpace(json, (size_t) bytes->length * 2 + 2,
+            error) < 0)
+        return DPI_FAILURE;
+    target = json->textBuffer + json->textBufferLength;
+    *target++ = '"';
+    for (i = 0; i < bytes->length; i++) {
+        *target++ = dpiJsonTextHexDigits[ptr[i] >> 4];
+        *target++ = dpiJsonTextHexDigits[ptr[i] & 0x0f];
+    }
+    *target++ = '"';
+    json->textBufferLength = (size_t) (target - json->textBuffer);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__writeDouble() [INTERNAL]
+//   Write a double or float value using the fewest significant digits that
+// convert back to the same value: from 15 up to 17 digits for doubles and
+// from 6 up to 9 digits for floats, which are compared after conversion back
+// to float. The decimal point written by sprintf() depends on the locale, so
+// it is replaced by the period that JSON requires. Values that cannot be
+// represented in JSON (NaN and infinity) are written as null.
+//-----------------------------------------------------------------------------
+static int dpiJsonText__writeDouble(dpiJson *json, double value, int isFloat,
+        dpiError *error)
+{
+    int i, j, length, precision, maxPrecision, foundDecimalPoint;
+    double convertedValue;
+    char buffer[40];
+
+    // NaN and infinity are written as null
+    if (isnan(value) || value - value != 0)
+        return dpiJsonText__write(json, "null", 4, error);
+
+    // determine the shortest representation that round-trips
+    precision = (isFloat) ? FLT_DIG : DBL_DIG;
+    maxPrecision = (isFloat) ? 9 : 17;
+    while (1) {
+        length = sprintf(buffer, "%.*g", precision, value);
+        convertedValue = strtod(buffer, NULL);
+        if (isFloat)
+            convertedValue = (float) convertedValue;
+        if (convertedValue == value || precision == maxPrecision)
+            break;
+        precision++;
+    }
+
+    // replace the decimal point of the locale (which may be more than one
+    // byte in length) with a period
+    for (i = 0, j = 0, foundDecimalPoint = 0; i < length; i++) {
+        if (isdigit((unsigned char) buffer[i]) || buffer[i] == '-' ||
+                buffer[i] == '+' || buffer[i] == 'e') {
+            buffer[j++] = buffer[i];
+        } else if (!foundDecimalPoint) {
+            buffer[j++] = '.';
+            foundDecimalPoint = 1;
+        }
+    }
+    return dpiJsonText__write(json, buffer, (size_t) j, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__writeIntervalDS() [INTERNAL]
+//   Write an interval day to second value as an ISO 8601 duration string.
+//-----------------------------------------------------------------------------
+static int dpiJsonText__writeIntervalDS(dpiJson *json,
+        const dpiIntervalDS *value, dpiError *error)
+{
+    int isNegative, length;
+    char buffer[80];
+
+    isNegative = (value->days < 0 || value->hours < 0 || value->minutes < 0 ||
+            value->seconds < 0 || value->fseconds < 0);
+    length = sprintf(buffer, "\"%sP%dDT%dH%dM%d", (isNegative) ? "-" : "",
+            abs(value->days), abs(value->hours), abs(value->minutes),
+            abs(value->seconds));
+    if (value->fseconds != 0) {
+        length += sprintf(buffer + length, ".%.9d", abs(value->fseconds));
+        while (buffer[length - 1] == '0')
+            length--;
+    }
+    buffer[length++] = 'S';
+    buffer[length++] = '"';
+    return dpiJsonText__write(json, buffer, (size_t) length, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__writeIntervalYM() [INTERNAL]
+//   Write an interval year to month value as an ISO 8601 duration string.
+//-----------------------------------------------------------------------------
+static int dpiJsonText__writeIntervalYM(dpiJson *json,
+        const dpiIntervalYM *value, dpiError *error)
+{
+    char buffer[40];
+    int length;
+
+    length = sprintf(buffer, "\"%sP%dY%dM\"",
+            (value->years < 0 || value->months < 0) ? "-" : "",
+            abs(value->years), abs(value->months));
+    return dpiJsonText__write(json, buffer, (size_t) length, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__writeNode() [INTERNAL]
+//   Write the node (and all of its children) to the text buffer.
+//-----------------------------------------------------------------------------
+static int dpiJsonText__writeNode(dpiJson *json, const dpiJsonNode *node,
+        dpiError *error)
+{
+    char buffer[40];
+    int length;
+
+    switch (node->nativeTypeNum) {
+        case DPI_NATIVE_TYPE_NULL:
+            return dpiJsonText__write(json, "null", 4, error);
+        case DPI_NATIVE_TYPE_BOOLEAN:
+            if (node->value->asBoolean)
+                return dpiJsonText__write(json, "true", 4, error);
+            return dpiJsonText__write(json, "false", 5, error);
+        case DPI_NATIVE_TYPE_JSON_ARRAY:
+            return dpiJsonText__writeArray(json, &node->value->asJsonArray,
+                    error);
+        case DPI_NATIVE_TYPE_JSON_OBJECT:
+            return dpiJsonText__writeObject(json, &node->value->asJsonObject,
+                    error);
+        case DPI_NATIVE_TYPE_BYTES:
+            switch (node->oracleTypeNum) {
+                case DPI_ORACLE_TYPE_NUMBER:
+                    return dpiJsonText__write(json, node->value->asBytes.ptr,
+                            node->value->asBytes.length, error);
+                case DPI_ORACLE_TYPE_RAW:
+                case DPI_ORACLE_TYPE_LONG_RAW:
+                case DPI_ORACLE_TYPE_JSON_ID:
+                case DPI_ORACLE_TYPE_VECTOR:
+                    return dpiJsonText__writeBinary(json,
+                            &node->value->asBytes, error);
+                default:
+                    return dpiJsonText__writeString(json,
+                            node->value->asBytes.ptr,
+                            node->value->asBytes.length, error);
+            }
+        case DPI_NATIVE_TYPE_DOUBLE:
+            return dpiJsonText__writeDouble(json, node->value->asDouble, 0,
+                    error);
+        case DPI_NATIVE_TYPE_FLOAT:
+            return dpiJsonText__writeDouble(json, node->value->asFloat, 1,
+                    error);
+        case DPI_NATIVE_TYPE_INT64:
+            length = sprintf(buffer, "%" PRId64, node->value->asInt64);
+            return dpiJsonText__write(json, buffer, (size_t) length, error);
+        case DPI_NATIVE_TYPE_UINT64:
+            length = sprintf(buffer, "%" PRIu64, node->value->asUint64);
+            return dpiJsonText__write(json, buffer, (size_t) length, error);
+        case DPI_NATIVE_TYPE_TIMESTAMP:
+            return dpiJsonText__writeTimestamp(json, node->oracleTypeNum,
+                    &node->value->asTimestamp, error);
+        case DPI_NATIVE_TYPE_INTERVAL_DS:
+            return dpiJsonText__writeIntervalDS(json,
+                    &node->value->asIntervalDS, error);
+        case DPI_NATIVE_TYPE_INTERVAL_YM:
+            return dpiJsonText__writeIntervalYM(json,
+                    &node->value->asIntervalYM, error);
+        default:
+            break;
+    }
+
+    return dpiError__set(error, "serialize JSON node",
+            DPI_ERR_UNHANDLED_CONVERSION_TO_JSON, node->nativeTypeNum,
+            node->oracleTypeNum);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__writeObject() [INTERNAL]
+//   Write an object and all of its fields.
+//-----------------------------------------------------------------------------
+static int dpiJsonText__writeObject(dpiJson *json, const dpiJsonObject *obj,
+        dpiError *error)
+{
+    uint32_t i;
+
+    if (dpiJsonText__write(json, "{", 1, error) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < obj->numFields; i++) {
+        if (i > 0 && dpiJsonText__write(json, ",", 1, error) < 0)
+            return DPI_FAILURE;
+        if (dpiJsonText__writeString(json, obj->fieldNames[i],
+                obj->fieldNameLengths[i], error) < 0)
+            return DPI_FAILURE;
+        if (dpiJsonText__write(json, ":", 1, error) < 0)
+            return DPI_FAILURE;
+        if (dpiJsonText__writeNode(json, &obj->fields[i], error) < 0)
+            return DPI_FAILURE;
+    }
+    return dpiJsonText__write(json, "}", 1, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__writeString() [INTERNAL]
+//   Write a string enclosed in double quotes, escaping any characters that
+// require it. The string is scanned eight bytes at a time and runs of bytes
+// that do not require escaping are copied in a single operation. Bytes
+// outside the ASCII range are copied unchanged.
+//-----------------------------------------------------------------------------
+static int dpiJsonText__writeString(dpiJson *json, const char *value,
+        uint32_t valueLength, dpiError *error)
+{
+    uint32_t pos = 0, runStart = 0;
+    char escape[6];
+    uint64_t chunk;
+    uint8_t ch;
+
+    if (dpiJsonText__write(json, "\"", 1, error) < 0)
+        return DPI_FAILURE;
+    while (pos < valueLength) {
+
+        // skip chunks of eight bytes that do not require escaping
+        if (valueLength - pos >= 8) {
+            memcpy(&chunk, value + pos, sizeof(chunk));
+            if (!DPI_JSON_TEXT_NEEDS_ESCAPE(chunk)) {
+                pos += 8;
+                continue;
+            }
+        }
+
+        // examine a single byte
+        ch = (uint8_t) value[pos];
+        if (ch >= 0x20 && ch != '"' && ch != '\\') {
+            pos++;
+            continue;
+        }
+
+        // write the run of bytes that did not require escaping, followed by
+        // the escaped byte
+        if (dpiJsonText__write(json, value + runStart, pos - runStart,
+                error) < 0)
+            return DPI_FAILURE;
+        escape[0] = '\\';
+        switch (ch) {
+            case '"':
+            case '\\':
+                escape[1] = (char) ch;
+                break;
+            case '\b':
+                escape[1] = 'b';
+                break;
+            case '\f':
+                escape[1] = 'f';
+                break;
+            case '\n':
+                escape[1] = 'n';
+                break;
+            case '\r':
+                escape[1] = 'r';
+                break;
+            case '\t':
+                escape[1] = 't';
+                break;
+            default:
+                escape[1] = 'u';
+                escape[2] = '0';
+                escape[3] = '0';
+                escape[4] = dpiJsonTextHexDigits[ch >> 4];
+                escape[5] = dpiJsonTextHexDigits[ch & 0x0f];
+                break;
+        }
+        if (dpiJsonText__write(json, escape, (escape[1] == 'u') ? 6 : 2,
+                error) < 0)
+            return DPI_FAILURE;
+        runStart = ++pos;
+
+    }
+    if (dpiJsonText__write(json, value + runStart, pos - runStart,
+            error) < 0)
+        return DPI_FAILURE;
+    return dpiJsonText__write(json, "\"", 1, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiJsonText__writeTimestamp() [INTERNAL]
+//   Write a date or timestamp value as an ISO 8601 string. The time zone
+// offset is only included for timestamps with time zone.
+//-----------------------------------------------------------------------------
+static int dpiJsonText__writeTimestamp(dpiJson *json,
+        dpiOracleTypeNum oracleTypeNum, const dpiTimestamp *value,
+        dpiError *error)
+{
+    char buffer[80];
+    int length;
+
+    length = sprintf(buffer, "\"%.4d-%.2u-%.2uT%.2u:%.2u:%.2u", value->year,
+            value->month, value->day, value->hour, value->minute,
+            value->second);
+    if (value->fsecond > 0) {
+        length += sprintf(buffer + length, ".%.9u", value->fsecond);
+        while (buffer[length - 1] == '0')
+            length--;
+    }
+    if (oracleTypeNum == DPI_ORACLE_TYPE_TIMESTAMP_TZ ||
+            oracleTypeNum == DPI_ORACLE_TYPE_TIMESTAMP_LTZ) {
+        if (value->tzHourOffset == 0 && value->tzMinuteOffset == 0)
+            buffer[length++] = 'Z';
+        else length += sprintf(buffer + length, "%c%.2d:%.2d",
+                (value->tzHourOffset < 0 || value->tzMinuteOffset < 0) ?
+                        '-' : '+',
+                abs(value->tzHourOffset), abs(value->tzMinuteOffset));
+    }
+    buffer[length++] = '"';
+    return dpiJsonText__write(json, buffer, (size_t) length, error);
+}
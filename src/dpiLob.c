@@ -267,6 +267,55 @@ int dpiLob_copy(dpiLob *lob, dpiLob **copiedLob)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiLob_copyToConn() [PUBLIC]
+//   Create a copy of the LOB locator associated with a different connection.
+// This allows a persistent LOB fetched on one connection to be read using a
+// different session acquired from the same pool.
+//-----------------------------------------------------------------------------
+int dpiLob_copyToConn(dpiLob *lob, dpiConn *conn, dpiLob **copiedLob)
+{
+    dpiLob *tempLob;
+    dpiError error;
+    int isTemporary;
+
+    // validate parameters
+    if (dpiLob__check(lob, __func__, &error) < 0)
+        return dpiGen__endPublicFn(lob, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(lob, copiedLob)
+    if (dpiGen__checkHandle(conn, DPI_HTYPE_CONN, "check connection",
+            &error) < 0)
+        return dpiGen__endPublicFn(lob, DPI_FAILURE, &error);
+    if (dpiConn__checkConnected(conn, &error) < 0)
+        return dpiGen__endPublicFn(lob, DPI_FAILURE, &error);
+
+    // the locator can only be used by connections sharing the same OCI
+    // environment and temporary LOBs only exist within the session that
+    // created them
+    if (conn->env != lob->env) {
+        dpiError__set(&error, "check environment",
+                DPI_ERR_LOB_COPY_WRONG_ENV);
+        return dpiGen__endPublicFn(lob, DPI_FAILURE, &error);
+    }
+    if (dpiOci__lobIsTemporary(lob, &isTemporary, 1, &error) < 0)
+        return dpiGen__endPublicFn(lob, DPI_FAILURE, &error);
+    if (isTemporary) {
+        dpiError__set(&error, "check temporary", DPI_ERR_LOB_COPY_TEMPORARY);
+        return dpiGen__endPublicFn(lob, DPI_FAILURE, &error);
+    }
+
+    // create the copy of the locator and associate it with the connection
+    if (dpiLob__allocate(conn, lob->type, &tempLob, &error) < 0)
+        return dpiGen__endPublicFn(lob, DPI_FAILURE, &error);
+    if (dpiOci__lobLocatorAssign(lob, &tempLob->locator, &error) < 0) {
+        dpiLob__free(tempLob, &error);
+        return dpiGen__endPublicFn(lob, DPI_FAILURE, &error);
+    }
+    *copiedLob = tempLob;
+    return dpiGen__endPublicFn(lob, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiLob_getBufferSize() [PUBLIC]
 //   Get the required size of a buffer given the number of characters. If the
@@ -413,6 +462,24 @@ int dpiLob_getType(dpiLob *lob, dpiOracleTypeNum *type)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiLob_newReader() [PUBLIC]
+//   Create a reader for streaming the contents of the LOB.
+//-----------------------------------------------------------------------------
+int dpiLob_newReader(dpiLob *lob, uint64_t offset, uint64_t amount,
+        dpiLobReader **reader)
+{
+    dpiError error;
+    int status;
+
+    if (dpiLob__check(lob, __func__, &error) < 0)
+        return dpiGen__endPublicFn(lob, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(lob, reader)
+    status = dpiLobReader__allocate(lob, offset, amount, reader, &error);
+    return dpiGen__endPublicFn(lob, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiLob_openResource() [PUBLIC]
 //   Open the LOB's resources to speed further accesses.
@@ -0,0 +1,340 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpiLobReader.c
+//   Implementation of LOB readers (streaming the contents of a LOB).
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// define minimum size of the buffer used for each piece read from the LOB; the
+// actual size is a multiple of the LOB chunk size
+#define DPI_LOB_READER_MIN_BUFFER_SIZE          65536
+
+
+//-----------------------------------------------------------------------------
+// dpiLobReader__allocate() [INTERNAL]
+//   Allocate and initialize a LOB reader. The buffer used for each piece is
+// sized as a multiple of the chunk size of the LOB. BFILEs that are not
+// already open are opened and remain open until the reader is closed.
+//-----------------------------------------------------------------------------
+int dpiLobReader__allocate(dpiLob *lob, uint64_t offset, uint64_t amount,
+        dpiLobReader **reader, dpiError *error)
+{
+    dpiLobReader *tempReader;
+    uint64_t chunkSize;
+    uint32_t temp;
+    int isOpen;
+
+    // determine the chunk size of the LOB in bytes; BFILEs do not have a
+    // chunk size so the minimum buffer size is used instead
+    if (lob->type->oracleTypeNum == DPI_ORACLE_TYPE_BFILE) {
+        chunkSize = DPI_LOB_READER_MIN_BUFFER_SIZE;
+    } else {
+        if (dpiOci__lobGetChunkSize(lob, &temp, error) < 0)
+            return DPI_FAILURE;
+        chunkSize = (temp == 0) ? DPI_LOB_READER_MIN_BUFFER_SIZE : temp;
+        if (lob->type->oracleTypeNum == DPI_ORACLE_TYPE_CLOB)
+            chunkSize *= lob->env->maxBytesPerCharacter;
+        else if (lob->type->oracleTypeNum == DPI_ORACLE_TYPE_NCLOB)
+            chunkSize *= lob->env->nmaxBytesPerCharacter;
+    }
+
+    // allocate reader and buffer
+    if (dpiGen__allocate(DPI_HTYPE_LOB_READER, lob->env,
+            (void**) &tempReader, error) < 0)
+        return DPI_FAILURE;
+    dpiGen__setRefCount(lob, error, 1);
+    tempReader->lob = lob;
+    tempReader->offset = (offset == 0) ? 1 : offset;
+    tempReader->amount = amount;
+    tempReader->bufferSize = chunkSize *
+            ((DPI_LOB_READER_MIN_BUFFER_SIZE + chunkSize - 1) / chunkSize);
+    if (dpiUtils__allocateMemory(1, (size_t) tempReader->bufferSize, 0,
+            "allocate LOB reader buffer", (void**) &tempReader->buffer,
+            error) < 0) {
+        dpiLobReader__free(tempReader, error);
+        return DPI_FAILURE;
+    }
+
+    // open the file for the lifetime of the reader, if needed
+    if (lob->type->oracleTypeNum == DPI_ORACLE_TYPE_BFILE) {
+        if (dpiOci__lobIsOpen(lob, &isOpen, error) < 0) {
+            dpiLobReader__free(tempReader, error);
+            return DPI_FAILURE;
+        }
+        if (!isOpen) {
+            if (dpiOci__lobOpen(lob, error) < 0) {
+                dpiLobReader__free(tempReader, error);
+                return DPI_FAILURE;
+            }
+            tempReader->openedFile = 1;
+        }
+    }
+
+    *reader = tempReader;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiLobReader__check() [INTERNAL]
+//   Determine if the LOB reader is valid and the LOB it is reading is still
+// open.
+//-----------------------------------------------------------------------------
+static int dpiLobReader__check(dpiLobReader *reader, const char *fnName,
+        dpiError *error)
+{
+    if (dpiGen__startPublicFn(reader, DPI_HTYPE_LOB_READER, fnName,
+            error) < 0)
+        return DPI_FAILURE;
+    if (!reader->buffer)
+        return dpiError__set(error, "check closed",
+                DPI_ERR_LOB_READER_CLOSED);
+    if (!reader->lob->locator)
+        return dpiError__set(error, "LOB closed?", DPI_ERR_LOB_CLOSED);
+    return dpiConn__checkConnected(reader->lob->conn, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiLobReader__close() [INTERNAL]
+//   Close the LOB reader. If the stream has been started but not completed,
+// the remainder is abandoned by interrupting the call and resetting the
+// connection so that it can be used again. A BFILE opened by the reader is
+// closed as well.
+//-----------------------------------------------------------------------------
+static int dpiLobReader__close(dpiLobReader *reader, int propagateErrors,
+        dpiError *error)
+{
+    dpiConn *conn = reader->lob->conn;
+    int status = DPI_SUCCESS;
+
+    if (reader->lob->locator && conn->handle && !conn->deadSession) {
+        if (reader->started && !reader->finished) {
+            status = dpiOci__break(conn, error);
+            if (status == DPI_SUCCESS)
+                status = dpiOci__reset(conn, error);
+            reader->finished = 1;
+        }
+        if (reader->openedFile) {
+            if (dpiOci__lobClose(reader->lob, error) < 0)
+                status = DPI_FAILURE;
+            reader->openedFile = 0;
+        }
+    }
+    if (reader->buffer) {
+        dpiUtils__freeMemory(reader->buffer);
+        reader->buffer = NULL;
+    }
+    return (propagateErrors) ? status : DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiLobReader__free() [INTERNAL]
+//   Free the memory for a LOB reader, abandoning any data not yet read.
+//-----------------------------------------------------------------------------
+void dpiLobReader__free(dpiLobReader *reader, dpiError *error)
+{
+    if (reader->lob) {
+        dpiLobReader__close(reader, 0, error);
+        dpiGen__setRefCount(reader->lob, error, -1);
+        reader->lob = NULL;
+    }
+    dpiUtils__freeMemory(reader);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiLobReader__read() [INTERNAL]
+//   Read the next piece of the LOB into the buffer. The first piece starts
+// the stream and subsequent pieces continue it; once the last piece has been
+// read, a length of zero is returned.
+//-----------------------------------------------------------------------------
+static int dpiLobReader__read(dpiLobReader *reader, uint64_t *valueLength,
+        dpiError *error)
+{
+    uint64_t amountInBytes = 0, amountInChars = 0;
+    int moreData;
+    uint8_t piece;
+
+    // nothing further to read once the last piece has been read
+    *valueLength = 0;
+    if (reader->finished)
+        return DPI_SUCCESS;
+
+    // the amount is only relevant for the first piece and is in characters
+    // for character LOBs and bytes for binary LOBs; an amount of zero reads to
+    // the end of the LOB
+    piece = DPI_OCI_NEXT_PIECE;
+    if (!reader->started) {
+        piece = DPI_OCI_FIRST_PIECE;
+        if (reader->lob->type->isCharacterData)
+            amountInChars = reader->amount;
+        else amountInBytes = reader->amount;
+    }
+
+    // read the piece; once the first piece has been read the connection is
+    // considered to be streaming until the last piece has been read
+    if (dpiOci__lobReadPiece(reader->lob, reader->offset, piece,
+            &amountInBytes, &amountInChars, reader->buffer, reader->bufferSize,
+            &moreData, error) < 0) {
+        if (reader->started)
+            reader->finished = 1;
+        return DPI_FAILURE;
+    }
+    reader->started = 1;
+    reader->finished = !moreData;
+    reader->numBytesRead += amountInBytes;
+    *valueLength = amountInBytes;
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiLobReader__writeToFd() [INTERNAL]
+//   Write the contents of the buffer to the file descriptor, continuing after
+// partial writes and interruptions.
+//-----------------------------------------------------------------------------
+static int dpiLobReader__writeToFd(dpiLobReader *reader, int fd,
+        uint64_t valueLength, dpiError *error)
+{
+    const char *ptr = reader->buffer;
+    unsigned int bytesToWrite;
+    int bytesWritten;
+
+    while (valueLength > 0) {
+        bytesToWrite = (valueLength > INT_MAX) ? INT_MAX :
+                (unsigned int) valueLength;
+#ifdef _WIN32
+        bytesWritten = _write(fd, ptr, bytesToWrite);
+#else
+        bytesWritten = (int) write(fd, ptr, bytesToWrite);
+        if (bytesWritten < 0 && errno == EINTR)
+            continue;
+#endif
+        if (bytesWritten < 0)
+            return dpiError__setFromOS(error, "write to file descriptor");
+        ptr += bytesWritten;
+        valueLength -= (uint64_t) bytesWritten;
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiLobReader_addRef() [PUBLIC]
+//   Add a reference to the LOB reader.
+//-----------------------------------------------------------------------------
+int dpiLobReader_addRef(dpiLobReader *reader)
+{
+    return dpiGen__addRef(reader, DPI_HTYPE_LOB_READER, __func__);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiLobReader_close() [PUBLIC]
+//   Close the LOB reader, abandoning any data that has not yet been read.
+//-----------------------------------------------------------------------------
+int dpiLobReader_close(dpiLobReader *reader)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(reader, DPI_HTYPE_LOB_READER, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(reader, DPI_FAILURE, &error);
+    status = dpiLobReader__close(reader, 1, &error);
+    return dpiGen__endPublicFn(reader, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiLobReader_read() [PUBLIC]
+//   Read the next piece of the LOB. A length of zero is returned once all of
+// the data has been read.
+//-----------------------------------------------------------------------------
+int dpiLobReader_read(dpiLobReader *reader, const char **value,
+        uint64_t *valueLength)
+{
+    dpiError error;
+    int status;
+
+    if (dpiLobReader__check(reader, __func__, &error) < 0)
+        return dpiGen__endPublicFn(reader, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(reader, value)
+    DPI_CHECK_PTR_NOT_NULL(reader, valueLength)
+    status = dpiLobReader__read(reader, valueLength, &error);
+    *value = reader->buffer;
+    return dpiGen__endPublicFn(reader, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiLobReader_readToFd() [PUBLIC]
+//   Read the remaining pieces of the LOB and write them to the file
+// descriptor. Each piece is written while the database continues streaming
+// the next one.
+//-----------------------------------------------------------------------------
+int dpiLobReader_readToFd(dpiLobReader *reader, int fd,
+        uint64_t *numBytesWritten)
+{
+    uint64_t valueLength, totalLength = 0;
+    dpiError error;
+    int status;
+
+    if (dpiLobReader__check(reader, __func__, &error) < 0)
+        return dpiGen__endPublicFn(reader, DPI_FAILURE, &error);
+    while (1) {
+        status = dpiLobReader__read(reader, &valueLength, &error);
+        if (status < 0 || valueLength == 0)
+            break;
+        status = dpiLobReader__writeToFd(reader, fd, valueLength, &error);
+        if (status < 0)
+            break;
+        totalLength += valueLength;
+    }
+    if (numBytesWritten)
+        *numBytesWritten = totalLength;
+    return dpiGen__endPublicFn(reader, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiLobReader_release() [PUBLIC]
+//   Release a reference to the LOB reader.
+//-----------------------------------------------------------------------------
+int dpiLobReader_release(dpiLobReader *reader)
+{
+    return dpiGen__release(reader, DPI_HTYPE_LOB_READER, __func__);
+}
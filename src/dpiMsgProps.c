@@ -62,6 +62,11 @@ int dpiMsgProps__allocate(dpiConn *conn, dpiMsgProps **props, dpiError *error)
 void dpiMsgProps__extractMsgId(dpiMsgProps *props, const char **msgId,
         uint32_t *msgIdLength)
 {
+    if (!props->msgIdRaw) {
+        *msgId = NULL;
+        *msgIdLength = 0;
+        return;
+    }
     dpiOci__rawPtr(props->env->handle, props->msgIdRaw, (void**) msgId);
     dpiOci__rawSize(props->env->handle, props->msgIdRaw, msgIdLength);
 }
@@ -73,6 +78,23 @@ void dpiMsgProps__extractMsgId(dpiMsgProps *props, const char **msgId,
 //-----------------------------------------------------------------------------
 void dpiMsgProps__free(dpiMsgProps *props, dpiError *error)
 {
+    dpiQueue *queue;
+    int recycled;
+
+    // message properties returned by a dequeue are returned to the queue for
+    // reuse by later dequeues, if possible; the reference to the queue is
+    // released afterwards since this may result in the queue (and any message
+    // properties it holds for reuse) being freed
+    if (props->queue) {
+        queue = props->queue;
+        props->queue = NULL;
+        recycled = (dpiQueue__recycleMsgProps(queue, props, error) ==
+                DPI_SUCCESS);
+        dpiGen__setRefCount(queue, error, -1);
+        if (recycled)
+            return;
+    }
+
     if (props->handle) {
         dpiOci__descriptorFree(props->handle, DPI_OCI_DTYPE_AQMSG_PROPERTIES);
         props->handle = NULL;
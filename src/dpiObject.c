@@ -403,6 +403,47 @@ static int dpiObject__fromOracleValue(dpiObject *obj, dpiError *error,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiObject__getAttributeValue() [INTERNAL]
+//   Get the value of the given attribute from the object after verifying that
+// the attribute belongs to the type of the object.
+//-----------------------------------------------------------------------------
+static int dpiObject__getAttributeValue(dpiObject *obj, dpiObjectAttr *attr,
+        dpiNativeTypeNum nativeTypeNum, dpiData *data, dpiError *error)
+{
+    int16_t scalarValueIndicator;
+    void *valueIndicator, *tdo;
+    dpiOracleData value;
+
+    // validate attribute
+    if (dpiGen__checkHandle(attr, DPI_HTYPE_OBJECT_ATTR, "get attribute value",
+            error) < 0)
+        return DPI_FAILURE;
+    if (attr->belongsToType->tdo != obj->type->tdo)
+        return dpiError__set(error, "get attribute value", DPI_ERR_WRONG_ATTR,
+                attr->nameLength, attr->name, obj->type->schemaLength,
+                obj->type->schema, obj->type->nameLength, obj->type->name);
+
+    // get attribute value
+    if (dpiOci__objectGetAttr(obj, attr, &scalarValueIndicator,
+            &valueIndicator, &value.asRaw, &tdo, error) < 0)
+        return DPI_FAILURE;
+
+    // determine the proper null indicator
+    if (!valueIndicator)
+        valueIndicator = &scalarValueIndicator;
+
+    // check to see if type is supported
+    if (!attr->typeInfo.oracleTypeNum)
+        return dpiError__set(error, "get attribute value",
+                DPI_ERR_UNHANDLED_DATA_TYPE, attr->typeInfo.ociTypeCode);
+
+    // convert to output data format
+    return dpiObject__fromOracleValue(obj, error, &attr->typeInfo, &value,
+            (int16_t*) valueIndicator, nativeTypeNum, data);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiObject__toOracleValue() [INTERNAL]
 //   Convert value from external type to the OCI data type required.
@@ -627,6 +668,44 @@ int dpiObject_appendElement(dpiObject *obj, dpiNativeTypeNum nativeTypeNum,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiObject_appendElements() [PUBLIC]
+//   Append a number of elements to the collection in a single call.
+//-----------------------------------------------------------------------------
+int dpiObject_appendElements(dpiObject *obj, dpiNativeTypeNum nativeTypeNum,
+        uint32_t numElements, dpiData *data)
+{
+    dpiOracleDataBuffer valueBuffer;
+    int16_t scalarValueIndicator;
+    int status = DPI_SUCCESS;
+    dpiLob *lob;
+    void *indicator;
+    dpiError error;
+    void *ociValue;
+    uint32_t i;
+
+    if (dpiObject__checkIsCollection(obj, __func__, &error) < 0)
+        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(obj, data)
+    for (i = 0; i < numElements && status == DPI_SUCCESS; i++) {
+        lob = NULL;
+        status = dpiObject__toOracleValue(obj, &error,
+                &obj->type->elementTypeInfo, &valueBuffer, &lob, &ociValue,
+                &scalarValueIndicator, (void**) &indicator, nativeTypeNum,
+                &data[i]);
+        if (status == DPI_SUCCESS) {
+            if (!indicator)
+                indicator = &scalarValueIndicator;
+            status = dpiOci__collAppend(obj->type->conn, ociValue, indicator,
+                    obj->instance, &error);
+        }
+        dpiObject__clearOracleValue(obj, &error, &valueBuffer, lob,
+                obj->type->elementTypeInfo.oracleTypeNum);
+    }
+    return dpiGen__endPublicFn(obj, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiObject_copy() [PUBLIC]
 //   Create a copy of the object and return it. Return NULL upon error.
@@ -674,45 +753,46 @@ int dpiObject_deleteElementByIndex(dpiObject *obj, int32_t index)
 int dpiObject_getAttributeValue(dpiObject *obj, dpiObjectAttr *attr,
         dpiNativeTypeNum nativeTypeNum, dpiData *data)
 {
-    int16_t scalarValueIndicator;
-    void *valueIndicator, *tdo;
-    dpiOracleData value;
     dpiError error;
     int status;
 
-    // validate parameters
     if (dpiObject__check(obj, __func__, &error) < 0)
         return DPI_FAILURE;
     DPI_CHECK_PTR_NOT_NULL(obj, data)
-    if (dpiGen__checkHandle(attr, DPI_HTYPE_OBJECT_ATTR, "get attribute value",
-            &error) < 0)
-        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
-    if (attr->belongsToType->tdo != obj->type->tdo) {
-        dpiError__set(&error, "get attribute value", DPI_ERR_WRONG_ATTR,
-                attr->nameLength, attr->name, obj->type->schemaLength,
-                obj->type->schema, obj->type->nameLength, obj->type->name);
-        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
-    }
+    status = dpiObject__getAttributeValue(obj, attr, nativeTypeNum, data,
+            &error);
+    return dpiGen__endPublicFn(obj, status, &error);
+}
 
-    // get attribute value
-    if (dpiOci__objectGetAttr(obj, attr, &scalarValueIndicator,
-            &valueIndicator, &value.asRaw, &tdo, &error) < 0)
-        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
 
-    // determine the proper null indicator
-    if (!valueIndicator)
-        valueIndicator = &scalarValueIndicator;
+//-----------------------------------------------------------------------------
+// dpiObject_getAttributeValues() [PUBLIC]
+//   Get the values of a number of attributes from the object in a single
+// call. If the array of native types is NULL, the default native type of each
+// attribute is used.
+//-----------------------------------------------------------------------------
+int dpiObject_getAttributeValues(dpiObject *obj, uint16_t numAttributes,
+        dpiObjectAttr **attributes, const dpiNativeTypeNum *nativeTypeNums,
+        dpiData *data)
+{
+    dpiNativeTypeNum nativeTypeNum;
+    int status = DPI_SUCCESS;
+    dpiError error;
+    uint16_t i;
 
-    // check to see if type is supported
-    if (!attr->typeInfo.oracleTypeNum) {
-        dpiError__set(&error, "get attribute value",
-                DPI_ERR_UNHANDLED_DATA_TYPE, attr->typeInfo.ociTypeCode);
-        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    if (dpiObject__check(obj, __func__, &error) < 0)
+        return DPI_FAILURE;
+    DPI_CHECK_PTR_NOT_NULL(obj, attributes)
+    DPI_CHECK_PTR_NOT_NULL(obj, data)
+    for (i = 0; i < numAttributes && status == DPI_SUCCESS; i++) {
+        if (nativeTypeNums)
+            nativeTypeNum = nativeTypeNums[i];
+        else if (attributes[i])
+            nativeTypeNum = attributes[i]->typeInfo.defaultNativeTypeNum;
+        else nativeTypeNum = 0;
+        status = dpiObject__getAttributeValue(obj, attributes[i],
+                nativeTypeNum, &data[i], &error);
     }
-
-    // convert to output data format
-    status = dpiObject__fromOracleValue(obj, &error, &attr->typeInfo, &value,
-            (int16_t*) valueIndicator, nativeTypeNum, data);
     return dpiGen__endPublicFn(obj, status, &error);
 }
 
@@ -766,6 +846,63 @@ int dpiObject_getElementValueByIndex(dpiObject *obj, int32_t index,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiObject_getElementValues() [PUBLIC]
+//   Return all of the elements in the collection in a single call. The number
+// of elements is an IN/OUT parameter: on input it is the number of elements
+// available in the data (and indices, if provided) arrays and on output it is
+// the number of elements that were populated. The elements are traversed in
+// index order in the same way as dpiObject_getFirstIndex() and
+// dpiObject_getNextIndex(), so deleted elements and gaps in the indices of
+// PL/SQL index-by tables are skipped.
+//-----------------------------------------------------------------------------
+int dpiObject_getElementValues(dpiObject *obj, dpiNativeTypeNum nativeTypeNum,
+        uint32_t *numElements, int32_t *indices, dpiData *data)
+{
+    dpiOracleData value;
+    uint32_t numFound;
+    int32_t index, size;
+    void *indicator;
+    dpiError error;
+    int exists;
+
+    if (dpiObject__checkIsCollection(obj, __func__, &error) < 0)
+        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(obj, numElements)
+    DPI_CHECK_PTR_NOT_NULL(obj, data)
+    if (dpiOci__tableSize(obj, &size, &error) < 0)
+        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    exists = (size != 0);
+    if (exists && dpiOci__tableFirst(obj, &index, &error) < 0)
+        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    for (numFound = 0; exists; numFound++) {
+        if (dpiOci__collGetElem(obj->type->conn, obj->instance, index,
+                &exists, &value.asRaw, &indicator, &error) < 0)
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        if (!exists) {
+            dpiError__set(&error, "get element value", DPI_ERR_INVALID_INDEX,
+                    index);
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        }
+        if (numFound == *numElements) {
+            dpiError__set(&error, "check array size",
+                    DPI_ERR_ARRAY_SIZE_TOO_SMALL, *numElements);
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        }
+        if (dpiObject__fromOracleValue(obj, &error,
+                &obj->type->elementTypeInfo, &value, (int16_t*) indicator,
+                nativeTypeNum, &data[numFound]) < 0)
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        if (indices)
+            indices[numFound] = index;
+        if (dpiOci__tableNext(obj, index, &index, &exists, &error) < 0)
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    }
+    *numElements = numFound;
+    return dpiGen__endPublicFn(obj, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiObject_getFirstIndex() [PUBLIC]
 //   Return the index of the first entry in the collection.
@@ -327,6 +327,7 @@ typedef void *(*dpiOciFnType__rawPtr)(void *env, const void *raw);
 typedef int (*dpiOciFnType__rawResize)(void *env, void *err, uint32_t new_size,
         void **raw);
 typedef uint32_t (*dpiOciFnType__rawSize)(void * env, const void *raw);
+typedef int (*dpiOciFnType__reset)(void *hndlp, void *errhp);
 typedef int (*dpiOciFnType__rowidToChar)(void *rowidDesc, char *outbfp,
         uint16_t *outbflp, void *errhp);
 typedef int (*dpiOciFnType__serverAttach)(void *srvhp, void *errhp,
@@ -632,6 +633,7 @@ static struct {
     dpiOciFnType__rawPtr fnRawPtr;
     dpiOciFnType__rawResize fnRawResize;
     dpiOciFnType__rawSize fnRawSize;
+    dpiOciFnType__reset fnReset;
     dpiOciFnType__rowidToChar fnRowidToChar;
     dpiOciFnType__serverAttach fnServerAttach;
     dpiOciFnType__serverDetach fnServerDetach;
@@ -2607,6 +2609,35 @@ int dpiOci__lobRead2(dpiLob *lob, uint64_t offset, uint64_t *amountInBytes,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiOci__lobReadPiece() [INTERNAL]
+//   Wrapper for OCILobRead2() in polling mode. The first piece is requested
+// with DPI_OCI_FIRST_PIECE and each subsequent piece with DPI_OCI_NEXT_PIECE
+// for as long as OCI indicates that more data is available. The amounts are
+// updated with the amount read into the buffer for each piece.
+//-----------------------------------------------------------------------------
+int dpiOci__lobReadPiece(dpiLob *lob, uint64_t offset, uint8_t piece,
+        uint64_t *amountInBytes, uint64_t *amountInChars, char *buffer,
+        uint64_t bufferLength, int *moreData, dpiError *error)
+{
+    uint16_t charsetId;
+    int status;
+
+    DPI_OCI_LOAD_SYMBOL("OCILobRead2", dpiOciSymbols.fnLobRead2)
+    DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    charsetId = (lob->type->charsetForm == DPI_SQLCS_NCHAR) ?
+            lob->env->ncharsetId : lob->env->charsetId;
+    status = (*dpiOciSymbols.fnLobRead2)(lob->conn->handle, error->handle,
+            lob->locator, amountInBytes, amountInChars, offset, buffer,
+            bufferLength, piece, NULL, NULL, charsetId,
+            lob->type->charsetForm);
+    *moreData = (status == DPI_OCI_NEED_DATA);
+    if (*moreData)
+        return DPI_SUCCESS;
+    DPI_OCI_CHECK_AND_RETURN(error, status, lob->conn, "read piece from LOB");
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__lobTrim2() [INTERNAL]
 //   Wrapper for OCILobTrim2().
@@ -3136,6 +3167,21 @@ static void *dpiOci__reallocMem(UNUSED void *unused, void *ptr, size_t newSize)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiOci__reset() [INTERNAL]
+//   Wrapper for OCIReset().
+//-----------------------------------------------------------------------------
+int dpiOci__reset(dpiConn *conn, dpiError *error)
+{
+    int status;
+
+    DPI_OCI_LOAD_SYMBOL("OCIReset", dpiOciSymbols.fnReset)
+    DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    status = (*dpiOciSymbols.fnReset)(conn->serverHandle, error->handle);
+    DPI_OCI_CHECK_AND_RETURN(error, status, conn, "reset");
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__rowidToChar() [INTERNAL]
 //   Wrapper for OCIRowidToChar().
@@ -4499,17 +4545,18 @@ int dpiOci__vectorFromSparseArray(dpiVector *vector, dpiVectorInfo *info,
 
 //-----------------------------------------------------------------------------
 // dpiOci__vectorToArray() [INTERNAL]
-//   Wrapper for OCIVectorToArray().
+//   Wrapper for OCIVectorToArray(). The dimensions are returned in the given
+// format, which need not match the format in which the vector is stored.
 //-----------------------------------------------------------------------------
-int dpiOci__vectorToArray(dpiVector *vector, dpiError *error)
+int dpiOci__vectorToArray(dpiVector *vector, uint8_t format,
+        uint32_t *numDimensions, void *dimensions, dpiError *error)
 {
     int status;
 
     DPI_OCI_LOAD_SYMBOL("OCIVectorToArray", dpiOciSymbols.fnVectorToArray)
     DPI_OCI_ENSURE_ERROR_HANDLE(error)
     status = (*dpiOciSymbols.fnVectorToArray)(vector->handle, error->handle,
-            vector->format, &vector->numDimensions, vector->dimensions,
-            DPI_OCI_DEFAULT);
+            format, numDimensions, dimensions, DPI_OCI_DEFAULT);
     DPI_OCI_CHECK_AND_RETURN(error, status, vector->conn, "vector to array");
 }
 
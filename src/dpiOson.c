@@ -0,0 +1,1086 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpiOson.c
+//   Implementation of decoding OSON (the binary format used for JSON) directly
+// into native JSON nodes without the use of the OCI JSON DOM.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+// forward declarations of internal functions only used in this file
+static int dpiOson__decodeHeader(dpiOsonDecoder *decoder, dpiError *error);
+static int dpiOson__decodeNode(dpiOsonDecoder *decoder, dpiJsonNode *node,
+        dpiError *error);
+static int dpiOson__decodeScalar(dpiOsonDecoder *decoder, uint8_t nodeType,
+        dpiJsonNode *node, dpiError *error);
+static int dpiOson__findPath(dpiOsonDecoder *decoder, const char *path,
+        uint32_t pathLength, int *found, dpiError *error);
+static int dpiOson__getContainerInfo(dpiOsonDecoder *decoder,
+        uint8_t nodeType, uint32_t *numChildren, uint32_t *fieldIdsPos,
+        uint32_t *offsetsPos, dpiError *error);
+static int dpiOson__getFieldId(dpiOsonDecoder *decoder, uint32_t fieldIdsPos,
+        uint32_t index, uint32_t *fieldId, dpiError *error);
+static int dpiOson__getFieldNames(dpiOsonDecoder *decoder,
+        uint32_t startIndex, uint32_t numNames, uint32_t hashIdLength,
+        uint32_t offsetLength, uint32_t segSize, dpiError *error);
+static int dpiOson__moveToChild(dpiOsonDecoder *decoder, uint8_t nodeType,
+        uint32_t containerOffset, uint32_t offsetsPos, uint32_t index,
+        dpiError *error);
+static int dpiOson__parsePathStep(const char *path, uint32_t pathLength,
+        uint32_t *pathPos, int *isIndex, uint32_t *nameStart,
+        uint32_t *nameLength, uint32_t *index, dpiError *error);
+static int dpiOson__readBytes(dpiOsonDecoder *decoder, uint64_t length,
+        const uint8_t **ptr, dpiError *error);
+static int dpiOson__readUInt8(dpiOsonDecoder *decoder, uint8_t *value,
+        dpiError *error);
+static int dpiOson__readUInt16(dpiOsonDecoder *decoder, uint16_t *value,
+        dpiError *error);
+static int dpiOson__readUInt32(dpiOsonDecoder *decoder, uint32_t *value,
+        dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decode() [INTERNAL]
+//   Decode the OSON data into native nodes owned by the JSON value. If a path
+// is specified, only the node identified by the path (and its children) is
+// decoded and the remainder of the document is skipped; if no node exists at
+// that path, NULL is returned. Strings, binary values and field names refer
+// directly to the OSON data.
+//-----------------------------------------------------------------------------
+int dpiOson__decode(dpiJson *json, const char *data, uint64_t dataLength,
+        const char *path, uint32_t pathLength, uint32_t options,
+        dpiJsonNode **node, dpiError *error)
+{
+    dpiOsonDecoder decoder;
+    int found = 1;
+
+    // reset the arena and the top level node
+    dpiJson__resetArena(json);
+    json->topNode.value = &json->topNodeBuffer;
+    json->topNode.oracleTypeNum = DPI_ORACLE_TYPE_NONE;
+    json->topNode.nativeTypeNum = DPI_NATIVE_TYPE_NULL;
+
+    // initialize decoder
+    if (dataLength > 0xffffffff)
+        return dpiError__set(error, "check OSON length",
+                DPI_ERR_INVALID_OSON, 0xffffffff);
+    memset(&decoder, 0, sizeof(decoder));
+    decoder.json = json;
+    decoder.data = (const uint8_t*) data;
+    decoder.dataLength = (uint32_t) dataLength;
+    decoder.options = options;
+
+    // decode header and field names, then position the decoder at the
+    // requested node and decode it
+    if (dpiOson__decodeHeader(&decoder, error) < 0)
+        return DPI_FAILURE;
+    if (path && pathLength > 0 &&
+            dpiOson__findPath(&decoder, path, pathLength, &found, error) < 0)
+        return DPI_FAILURE;
+    if (!found) {
+        *node = NULL;
+        return DPI_SUCCESS;
+    }
+    if (dpiOson__decodeNode(&decoder, &json->topNode, error) < 0)
+        return DPI_FAILURE;
+    *node = &json->topNode;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decodeBinaryDouble() [INTERNAL]
+//   Decode an Oracle BINARY_DOUBLE value. The value is stored big endian with
+// the sign bit inverted for positive values and all bits inverted for
+// negative values so that the bytes can be compared directly.
+//-----------------------------------------------------------------------------
+static double dpiOson__decodeBinaryDouble(const uint8_t *ptr)
+{
+    uint64_t bits = 0;
+    double value;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        bits = (bits << 8) | ptr[i];
+    if (ptr[0] & 0x80)
+        bits &= ~((uint64_t) 1 << 63);
+    else bits = ~bits;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decodeBinaryFloat() [INTERNAL]
+//   Decode an Oracle BINARY_FLOAT value. The encoding is the same as for
+// BINARY_DOUBLE values.
+//-----------------------------------------------------------------------------
+static float dpiOson__decodeBinaryFloat(const uint8_t *ptr)
+{
+    uint32_t bits = 0;
+    float value;
+    int i;
+
+    for (i = 0; i < 4; i++)
+        bits = (bits << 8) | ptr[i];
+    if (ptr[0] & 0x80)
+        bits &= ~((uint32_t) 1 << 31);
+    else bits = ~bits;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decodeBytes() [INTERNAL]
+//   Decode a string or binary value of the given length. The node refers
+// directly to the OSON data.
+//-----------------------------------------------------------------------------
+static int dpiOson__decodeBytes(dpiOsonDecoder *decoder, dpiJsonNode *node,
+        dpiOracleTypeNum oracleTypeNum, uint32_t length, dpiError *error)
+{
+    const uint8_t *ptr;
+
+    if (dpiOson__readBytes(decoder, length, &ptr, error) < 0)
+        return DPI_FAILURE;
+    node->oracleTypeNum = oracleTypeNum;
+    node->nativeTypeNum = DPI_NATIVE_TYPE_BYTES;
+    node->value->asBytes.ptr = (char*) ptr;
+    node->value->asBytes.length = length;
+    node->value->asBytes.encoding = NULL;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decodeContainer() [INTERNAL]
+//   Decode an object or array node and all of its children.
+//-----------------------------------------------------------------------------
+static int dpiOson__decodeContainer(dpiOsonDecoder *decoder,
+        uint8_t nodeType, uint32_t containerOffset, dpiJsonNode *node,
+        dpiError *error)
+{
+    uint32_t i, numChildren, fieldIdsPos, offsetsPos, fieldId;
+    dpiJsonArray *array;
+    dpiJsonObject *obj;
+
+    if (dpiOson__getContainerInfo(decoder, nodeType, &numChildren,
+            &fieldIdsPos, &offsetsPos, error) < 0)
+        return DPI_FAILURE;
+
+    // arrays
+    if (nodeType & 0x40) {
+        node->oracleTypeNum = DPI_ORACLE_TYPE_JSON_ARRAY;
+        node->nativeTypeNum = DPI_NATIVE_TYPE_JSON_ARRAY;
+        array = &node->value->asJsonArray;
+        array->numElements = numChildren;
+        array->elements = NULL;
+        array->elementValues = NULL;
+        if (numChildren == 0)
+            return DPI_SUCCESS;
+        if (dpiJson__allocateFromArena(decoder->json,
+                numChildren * sizeof(dpiJsonNode),
+                (void**) &array->elements, error) < 0)
+            return DPI_FAILURE;
+        if (dpiJson__allocateFromArena(decoder->json,
+                numChildren * sizeof(dpiDataBuffer),
+                (void**) &array->elementValues, error) < 0)
+            return DPI_FAILURE;
+        for (i = 0; i < numChildren; i++) {
+            array->elements[i].value = &array->elementValues[i];
+            if (dpiOson__moveToChild(decoder, nodeType, containerOffset,
+                    offsetsPos, i, error) < 0)
+                return DPI_FAILURE;
+            if (dpiOson__decodeNode(decoder, &array->elements[i], error) < 0)
+                return DPI_FAILURE;
+        }
+        return DPI_SUCCESS;
+    }
+
+    // objects
+    node->oracleTypeNum = DPI_ORACLE_TYPE_JSON_OBJECT;
+    node->nativeTypeNum = DPI_NATIVE_TYPE_JSON_OBJECT;
+    obj = &node->value->asJsonObject;
+    obj->numFields = numChildren;
+    obj->fieldNames = NULL;
+    obj->fieldNameLengths = NULL;
+    obj->fields = NULL;
+    obj->fieldValues = NULL;
+    if (numChildren == 0)
+        return DPI_SUCCESS;
+    if (dpiJson__allocateFromArena(decoder->json, numChildren * sizeof(char*),
+            (void**) &obj->fieldNames, error) < 0)
+        return DPI_FAILURE;
+    if (dpiJson__allocateFromArena(decoder->json,
+            numChildren * sizeof(uint32_t), (void**) &obj->fieldNameLengths,
+            error) < 0)
+        return DPI_FAILURE;
+    if (dpiJson__allocateFromArena(decoder->json,
+            numChildren * sizeof(dpiJsonNode), (void**) &obj->fields,
+            error) < 0)
+        return DPI_FAILURE;
+    if (dpiJson__allocateFromArena(decoder->json,
+            numChildren * sizeof(dpiDataBuffer), (void**) &obj->fieldValues,
+            error) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < numChildren; i++) {
+        if (dpiOson__getFieldId(decoder, fieldIdsPos, i, &fieldId, error) < 0)
+            return DPI_FAILURE;
+        obj->fieldNames[i] = (char*) decoder->fieldNames[fieldId - 1];
+        obj->fieldNameLengths[i] = decoder->fieldNameLengths[fieldId - 1];
+        obj->fields[i].value = &obj->fieldValues[i];
+        if (dpiOson__moveToChild(decoder, nodeType, containerOffset,
+                offsetsPos, i, error) < 0)
+            return DPI_FAILURE;
+        if (dpiOson__decodeNode(decoder, &obj->fields[i], error) < 0)
+            return DPI_FAILURE;
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decodeDateTime() [INTERNAL]
+//   Decode a date or timestamp value. The first seven bytes are in the format
+// used by Oracle dates, followed by the fractional seconds for timestamps and
+// by the time zone offset for timestamps with time zone.
+//-----------------------------------------------------------------------------
+static int dpiOson__decodeDateTime(dpiOsonDecoder *decoder,
+        dpiJsonNode *node, dpiOracleTypeNum oracleTypeNum, uint32_t length,
+        dpiError *error)
+{
+    dpiTimestamp *timestamp;
+    const uint8_t *ptr;
+    dpiOciDate date;
+
+    if (dpiOson__readBytes(decoder, length, &ptr, error) < 0)
+        return DPI_FAILURE;
+    node->oracleTypeNum = oracleTypeNum;
+    timestamp = &node->value->asTimestamp;
+    timestamp->year = (int16_t) ((ptr[0] - 100) * 100 + ptr[1] - 100);
+    timestamp->month = ptr[2];
+    timestamp->day = ptr[3];
+    timestamp->hour = (uint8_t) (ptr[4] - 1);
+    timestamp->minute = (uint8_t) (ptr[5] - 1);
+    timestamp->second = (uint8_t) (ptr[6] - 1);
+    timestamp->fsecond = (length < 11) ? 0 :
+            ((uint32_t) ptr[7] << 24) | ((uint32_t) ptr[8] << 16) |
+            ((uint32_t) ptr[9] << 8) | ptr[10];
+    timestamp->tzHourOffset = (length < 13) ? 0 : (int8_t) (ptr[11] - 20);
+    timestamp->tzMinuteOffset = (length < 13) ? 0 : (int8_t) (ptr[12] - 60);
+    if (!(decoder->options & DPI_JSON_OPT_DATE_AS_DOUBLE)) {
+        node->nativeTypeNum = DPI_NATIVE_TYPE_TIMESTAMP;
+        return DPI_SUCCESS;
+    }
+
+    // convert to a double, as is done when the OCI DOM is used
+    date.year = timestamp->year;
+    date.month = timestamp->month;
+    date.day = timestamp->day;
+    date.hour = timestamp->hour;
+    date.minute = timestamp->minute;
+    date.second = timestamp->second;
+    length = timestamp->fsecond;
+    node->nativeTypeNum = DPI_NATIVE_TYPE_DOUBLE;
+    if (dpiDataBuffer__fromOracleDateAsDouble(node->value,
+            decoder->json->env, error, &date) < 0)
+        return DPI_FAILURE;
+    node->value->asDouble += (length / 1000000);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decodeHeader() [INTERNAL]
+//   Decode the header of the OSON data and the field names that are used by
+// the objects in the document. After this function returns, the decoder is
+// positioned at the root node.
+//-----------------------------------------------------------------------------
+static int dpiOson__decodeHeader(dpiOsonDecoder *decoder, dpiError *error)
+{
+    uint32_t numShortFieldNames, shortFieldNamesSegSize, temp32;
+    uint32_t numLongFieldNames = 0, longFieldNamesSegSize = 0;
+    uint16_t primaryFlags, secondaryFlags = 0, temp16;
+    uint8_t version, temp8;
+    const uint8_t *ptr;
+
+    // verify magic bytes and version
+    if (dpiOson__readBytes(decoder, 3, &ptr, error) < 0)
+        return DPI_FAILURE;
+    if (ptr[0] != DPI_OSON_MAGIC_BYTE_1 || ptr[1] != DPI_OSON_MAGIC_BYTE_2 ||
+            ptr[2] != DPI_OSON_MAGIC_BYTE_3)
+        return dpiError__set(error, "check OSON magic bytes",
+                DPI_ERR_INVALID_OSON, 0);
+    if (dpiOson__readUInt8(decoder, &version, error) < 0)
+        return DPI_FAILURE;
+    if (version != DPI_OSON_VERSION_MAX_FNAME_255 &&
+            version != DPI_OSON_VERSION_MAX_FNAME_65535)
+        return dpiError__set(error, "check OSON version",
+                DPI_ERR_INVALID_OSON, decoder->pos - 1);
+    if (dpiOson__readUInt16(decoder, &primaryFlags, error) < 0)
+        return DPI_FAILURE;
+    decoder->relativeOffsets =
+            (primaryFlags & DPI_OSON_FLAG_REL_OFFSET_MODE) ? 1 : 0;
+
+    // if the value is a scalar, only the size of the tree segment follows
+    if (primaryFlags & DPI_OSON_FLAG_IS_SCALAR) {
+        if (primaryFlags & DPI_OSON_FLAG_TREE_SEG_UINT32) {
+            if (dpiOson__readUInt32(decoder, &temp32, error) < 0)
+                return DPI_FAILURE;
+        } else if (dpiOson__readUInt16(decoder, &temp16, error) < 0) {
+            return DPI_FAILURE;
+        }
+        decoder->treeSegPos = decoder->pos;
+        return DPI_SUCCESS;
+    }
+
+    // determine the number of field names and the size of field ids
+    if (primaryFlags & DPI_OSON_FLAG_NUM_FNAMES_UINT32) {
+        if (dpiOson__readUInt32(decoder, &numShortFieldNames, error) < 0)
+            return DPI_FAILURE;
+        decoder->fieldIdLength = 4;
+    } else if (primaryFlags & DPI_OSON_FLAG_NUM_FNAMES_UINT16) {
+        if (dpiOson__readUInt16(decoder, &temp16, error) < 0)
+            return DPI_FAILURE;
+        numShortFieldNames = temp16;
+        decoder->fieldIdLength = 2;
+    } else {
+        if (dpiOson__readUInt8(decoder, &temp8, error) < 0)
+            return DPI_FAILURE;
+        numShortFieldNames = temp8;
+        decoder->fieldIdLength = 1;
+    }
+
+    // determine the size of the field names segment
+    if (primaryFlags & DPI_OSON_FLAG_FNAMES_SEG_UINT32) {
+        if (dpiOson__readUInt32(decoder, &shortFieldNamesSegSize, error) < 0)
+            return DPI_FAILURE;
+    } else {
+        if (dpiOson__readUInt16(decoder, &temp16, error) < 0)
+            return DPI_FAILURE;
+        shortFieldNamesSegSize = temp16;
+    }
+
+    // field names longer than 255 bytes are stored in a separate segment
+    if (version == DPI_OSON_VERSION_MAX_FNAME_65535) {
+        if (dpiOson__readUInt16(decoder, &secondaryFlags, error) < 0)
+            return DPI_FAILURE;
+        if (dpiOson__readUInt32(decoder, &numLongFieldNames, error) < 0)
+            return DPI_FAILURE;
+        if (dpiOson__readUInt32(decoder, &longFieldNamesSegSize, error) < 0)
+            return DPI_FAILURE;
+    }
+
+    // skip the size of the tree segment and the number of "tiny" nodes
+    if (primaryFlags & DPI_OSON_FLAG_TREE_SEG_UINT32) {
+        if (dpiOson__readUInt32(decoder, &temp32, error) < 0)
+            return DPI_FAILURE;
+    } else if (dpiOson__readUInt16(decoder, &temp16, error) < 0) {
+        return DPI_FAILURE;
+    }
+    if (dpiOson__readUInt16(decoder, &temp16, error) < 0)
+        return DPI_FAILURE;
+
+    // each field name requires at least one byte so the number of field names
+    // cannot exceed the size of the data
+    if ((uint64_t) numShortFieldNames + numLongFieldNames >
+            decoder->dataLength)
+        return dpiError__set(error, "check number of field names",
+                DPI_ERR_INVALID_OSON, decoder->pos);
+    decoder->numFieldNames = numShortFieldNames + numLongFieldNames;
+    if (decoder->numFieldNames > 0) {
+        if (dpiJson__allocateFromArena(decoder->json,
+                decoder->numFieldNames * sizeof(char*),
+                (void**) &decoder->fieldNames, error) < 0)
+            return DPI_FAILURE;
+        if (dpiJson__allocateFromArena(decoder->json,
+                decoder->numFieldNames * sizeof(uint32_t),
+                (void**) &decoder->fieldNameLengths, error) < 0)
+            return DPI_FAILURE;
+    }
+    if (numShortFieldNames > 0 && dpiOson__getFieldNames(decoder, 0,
+            numShortFieldNames, 1,
+            (primaryFlags & DPI_OSON_FLAG_FNAMES_SEG_UINT32) ? 4 : 2,
+            shortFieldNamesSegSize, error) < 0)
+        return DPI_FAILURE;
+    if (numLongFieldNames > 0 && dpiOson__getFieldNames(decoder,
+            numShortFieldNames, numLongFieldNames, 2,
+            (secondaryFlags & DPI_OSON_FLAG_SEC_FNAMES_SEG_UINT16) ? 2 : 4,
+            longFieldNamesSegSize, error) < 0)
+        return DPI_FAILURE;
+
+    decoder->treeSegPos = decoder->pos;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decodeIntervalDS() [INTERNAL]
+//   Decode an interval day to second value.
+//-----------------------------------------------------------------------------
+static int dpiOson__decodeIntervalDS(dpiOsonDecoder *decoder,
+        dpiJsonNode *node, dpiError *error)
+{
+    dpiIntervalDS *interval;
+    const uint8_t *ptr;
+    uint32_t temp32;
+
+    if (dpiOson__readBytes(decoder, 11, &ptr, error) < 0)
+        return DPI_FAILURE;
+    node->oracleTypeNum = DPI_ORACLE_TYPE_INTERVAL_DS;
+    node->nativeTypeNum = DPI_NATIVE_TYPE_INTERVAL_DS;
+    interval = &node->value->asIntervalDS;
+    temp32 = ((uint32_t) ptr[0] << 24) | ((uint32_t) ptr[1] << 16) |
+            ((uint32_t) ptr[2] << 8) | ptr[3];
+    interval->days = (int32_t) (temp32 - 0x80000000);
+    interval->hours = ptr[4] - 60;
+    interval->minutes = ptr[5] - 60;
+    interval->seconds = ptr[6] - 60;
+    temp32 = ((uint32_t) ptr[7] << 24) | ((uint32_t) ptr[8] << 16) |
+            ((uint32_t) ptr[9] << 8) | ptr[10];
+    interval->fseconds = (int32_t) (temp32 - 0x80000000);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decodeIntervalYM() [INTERNAL]
+//   Decode an interval year to month value.
+//-----------------------------------------------------------------------------
+static int dpiOson__decodeIntervalYM(dpiOsonDecoder *decoder,
+        dpiJsonNode *node, dpiError *error)
+{
+    const uint8_t *ptr;
+    uint32_t temp32;
+
+    if (dpiOson__readBytes(decoder, 5, &ptr, error) < 0)
+        return DPI_FAILURE;
+    node->oracleTypeNum = DPI_ORACLE_TYPE_INTERVAL_YM;
+    node->nativeTypeNum = DPI_NATIVE_TYPE_INTERVAL_YM;
+    temp32 = ((uint32_t) ptr[0] << 24) | ((uint32_t) ptr[1] << 16) |
+            ((uint32_t) ptr[2] << 8) | ptr[3];
+    node->value->asIntervalYM.years = (int32_t) (temp32 - 0x80000000);
+    node->value->asIntervalYM.months = ptr[4] - 60;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decodeNode() [INTERNAL]
+//   Decode the node at the current position. Each node occupies at least one
+// byte of the tree segment so a document that requires more nodes than that
+// must refer to the same node more than once and is rejected; the nesting
+// depth is also limited so that malformed data cannot exhaust the stack.
+//-----------------------------------------------------------------------------
+static int dpiOson__decodeNode(dpiOsonDecoder *decoder, dpiJsonNode *node,
+        dpiError *error)
+{
+    uint32_t containerOffset;
+    uint8_t nodeType;
+    int status;
+
+    containerOffset = decoder->pos - decoder->treeSegPos;
+    if (++decoder->numNodes > decoder->dataLength - decoder->treeSegPos)
+        return dpiError__set(error, "check number of nodes",
+                DPI_ERR_INVALID_OSON, decoder->pos);
+    if (dpiOson__readUInt8(decoder, &nodeType, error) < 0)
+        return DPI_FAILURE;
+    if (!(nodeType & 0x80))
+        return dpiOson__decodeScalar(decoder, nodeType, node, error);
+    if (decoder->depth >= DPI_OSON_MAX_DEPTH)
+        return dpiError__set(error, "check depth", DPI_ERR_INVALID_OSON,
+                decoder->pos - 1);
+    decoder->depth++;
+    status = dpiOson__decodeContainer(decoder, nodeType, containerOffset,
+            node, error);
+    decoder->depth--;
+    return status;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decodeNumber() [INTERNAL]
+//   Decode a number stored in the format used by Oracle numbers.
+//-----------------------------------------------------------------------------
+static int dpiOson__decodeNumber(dpiOsonDecoder *decoder, dpiJsonNode *node,
+        uint32_t length, dpiError *error)
+{
+    uint8_t numBuffer[DPI_OCI_NUMBER_SIZE];
+    const uint8_t *ptr;
+
+    // populate a buffer in the format used by OCI numbers
+    if (length > DPI_OCI_NUMBER_SIZE - 1)
+        return dpiError__set(error, "check number length",
+                DPI_ERR_INVALID_OSON, decoder->pos);
+    if (dpiOson__readBytes(decoder, length, &ptr, error) < 0)
+        return DPI_FAILURE;
+    if (length == 0) {
+        numBuffer[0] = 1;
+        numBuffer[1] = 0x80;
+    } else {
+        numBuffer[0] = (uint8_t) length;
+        memcpy(&numBuffer[1], ptr, length);
+    }
+
+    // convert to text or to a double
+    node->oracleTypeNum = DPI_ORACLE_TYPE_NUMBER;
+    if (decoder->options & DPI_JSON_OPT_NUMBER_AS_STRING) {
+        node->nativeTypeNum = DPI_NATIVE_TYPE_BYTES;
+        return dpiJsonNode__fromOracleNumberAsText(decoder->json, node,
+                numBuffer, error);
+    }
+    node->nativeTypeNum = DPI_NATIVE_TYPE_DOUBLE;
+    return dpiDataBuffer__fromOracleNumberAsDouble(node->value, error,
+            numBuffer);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__decodeScalar() [INTERNAL]
+//   Decode a scalar node with the given node type. The types returned match
+// those returned when the OCI DOM is used.
+//-----------------------------------------------------------------------------
+static int dpiOson__decodeScalar(dpiOsonDecoder *decoder, uint8_t nodeType,
+        dpiJsonNode *node, dpiError *error)
+{
+    const uint8_t *ptr;
+    uint32_t temp32;
+    uint16_t temp16;
+    uint8_t temp8;
+
+    switch (nodeType) {
+        case DPI_OSON_TYPE_NULL:
+            node->oracleTypeNum = DPI_ORACLE_TYPE_NONE;
+            node->nativeTypeNum = DPI_NATIVE_TYPE_NULL;
+            return DPI_SUCCESS;
+        case DPI_OSON_TYPE_TRUE:
+        case DPI_OSON_TYPE_FALSE:
+            node->oracleTypeNum = DPI_ORACLE_TYPE_BOOLEAN;
+            node->nativeTypeNum = DPI_NATIVE_TYPE_BOOLEAN;
+            node->value->asBoolean = (nodeType == DPI_OSON_TYPE_TRUE);
+            return DPI_SUCCESS;
+        case DPI_OSON_TYPE_DATE:
+            return dpiOson__decodeDateTime(decoder, node,
+                    DPI_ORACLE_TYPE_DATE, 7, error);
+        case DPI_OSON_TYPE_TIMESTAMP7:
+            return dpiOson__decodeDateTime(decoder, node,
+                    DPI_ORACLE_TYPE_TIMESTAMP, 7, error);
+        case DPI_OSON_TYPE_TIMESTAMP:
+            return dpiOson__decodeDateTime(decoder, node,
+                    DPI_ORACLE_TYPE_TIMESTAMP, 11, error);
+        case DPI_OSON_TYPE_TIMESTAMP_TZ:
+            return dpiOson__decodeDateTime(decoder, node,
+                    DPI_ORACLE_TYPE_TIMESTAMP, 13, error);
+        case DPI_OSON_TYPE_BINARY_FLOAT:
+            if (dpiOson__readBytes(decoder, 4, &ptr, error) < 0)
+                return DPI_FAILURE;
+            node->oracleTypeNum = DPI_ORACLE_TYPE_NUMBER;
+            node->nativeTypeNum = DPI_NATIVE_TYPE_FLOAT;
+            node->value->asFloat = dpiOson__decodeBinaryFloat(ptr);
+            return DPI_SUCCESS;
+        case DPI_OSON_TYPE_BINARY_DOUBLE:
+            if (dpiOson__readBytes(decoder, 8, &ptr, error) < 0)
+                return DPI_FAILURE;
+            node->oracleTypeNum = DPI_ORACLE_TYPE_NUMBER;
+            node->nativeTypeNum = DPI_NATIVE_TYPE_DOUBLE;
+            node->value->asDouble = dpiOson__decodeBinaryDouble(ptr);
+            return DPI_SUCCESS;
+        case DPI_OSON_TYPE_INTERVAL_DS:
+            return dpiOson__decodeIntervalDS(decoder, node, error);
+        case DPI_OSON_TYPE_INTERVAL_YM:
+            return dpiOson__decodeIntervalYM(decoder, node, error);
+        case DPI_OSON_TYPE_STRING_LENGTH_UINT8:
+            if (dpiOson__readUInt8(decoder, &temp8, error) < 0)
+                return DPI_FAILURE;
+            return dpiOson__decodeBytes(decoder, node,
+                    DPI_ORACLE_TYPE_VARCHAR, temp8, error);
+        case DPI_OSON_TYPE_STRING_LENGTH_UINT16:
+            if (dpiOson__readUInt16(decoder, &temp16, error) < 0)
+                return DPI_FAILURE;
+            return dpiOson__decodeBytes(decoder, node,
+                    DPI_ORACLE_TYPE_VARCHAR, temp16, error);
+        case DPI_OSON_TYPE_STRING_LENGTH_UINT32:
+            if (dpiOson__readUInt32(decoder, &temp32, error) < 0)
+                return DPI_FAILURE;
+            return dpiOson__decodeBytes(decoder, node,
+                    DPI_ORACLE_TYPE_VARCHAR, temp32, error);
+        case DPI_OSON_TYPE_NUMBER_LENGTH_UINT8:
+        case DPI_OSON_TYPE_DECIMAL_LENGTH_UINT8:
+            if (dpiOson__readUInt8(decoder, &temp8, error) < 0)
+                return DPI_FAILURE;
+            return dpiOson__decodeNumber(decoder, node, temp8, error);
+        case DPI_OSON_TYPE_ID:
+            if (dpiOson__readUInt8(decoder, &temp8, error) < 0)
+                return DPI_FAILURE;
+            return dpiOson__decodeBytes(decoder, node,
+                    (decoder->json->env->context->useJsonId) ?
+                            DPI_ORACLE_TYPE_JSON_ID : DPI_ORACLE_TYPE_RAW,
+                    temp8, error);
+        case DPI_OSON_TYPE_BINARY_LENGTH_UINT16:
+            if (dpiOson__readUInt16(decoder, &temp16, error) < 0)
+                return DPI_FAILURE;
+            return dpiOson__decodeBytes(decoder, node, DPI_ORACLE_TYPE_RAW,
+                    temp16, error);
+        case DPI_OSON_TYPE_BINARY_LENGTH_UINT32:
+            if (dpiOson__readUInt32(decoder, &temp32, error) < 0)
+                return DPI_FAILURE;
+            return dpiOson__decodeBytes(decoder, node, DPI_ORACLE_TYPE_RAW,
+                    temp32, error);
+        case DPI_OSON_TYPE_EXTENDED:
+            if (dpiOson__readUInt8(decoder, &temp8, error) < 0)
+                return DPI_FAILURE;
+            if (temp8 != DPI_OSON_TYPE_VECTOR)
+                break;
+            if (dpiOson__readUInt32(decoder, &temp32, error) < 0)
+                return DPI_FAILURE;
+            return dpiOson__decodeBytes(decoder, node, DPI_ORACLE_TYPE_VECTOR,
+                    temp32, error);
+        default:
+
+            // numbers with the length stored in the node type
+            if ((nodeType & 0xf0) == 0x20 || (nodeType & 0xf0) == 0x60)
+                return dpiOson__decodeNumber(decoder, node,
+                        (nodeType & 0x0f) + 1u, error);
+
+            // integers with the length stored in the node type
+            if ((nodeType & 0xf0) == 0x40 || (nodeType & 0xf0) == 0x50)
+                return dpiOson__decodeNumber(decoder, node, nodeType & 0x1f,
+                        error);
+
+            // strings with the length stored in the node type
+            if ((nodeType & 0xe0) == 0)
+                return dpiOson__decodeBytes(decoder, node,
+                        DPI_ORACLE_TYPE_VARCHAR, nodeType, error);
+            break;
+    }
+
+    return dpiError__set(error, "decode OSON scalar", DPI_ERR_INVALID_OSON,
+            decoder->pos - 1);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__findPath() [INTERNAL]
+//   Position the decoder at the node identified by the path, without decoding
+// any of the nodes along the way. The path consists of field names separated
+// by periods and array indices enclosed in square brackets, optionally
+// preceded by "$" (for example, "$.orders[2].id"). The entire path is
+// validated before the document is examined.
+//-----------------------------------------------------------------------------
+static int dpiOson__findPath(dpiOsonDecoder *decoder, const char *path,
+        uint32_t pathLength, int *found, dpiError *error)
+{
+    uint32_t containerOffset, numChildren, fieldIdsPos, offsetsPos, fieldId;
+    uint32_t pathPos, startPos, nameStart, nameLength, index, i;
+    uint8_t nodeType;
+    int isIndex;
+
+    // validate the path
+    *found = 0;
+    startPos = (path[0] == '$') ? 1 : 0;
+    pathPos = startPos;
+    while (pathPos < pathLength) {
+        if (dpiOson__parsePathStep(path, pathLength, &pathPos, &isIndex,
+                &nameStart, &nameLength, &index, error) < 0)
+            return DPI_FAILURE;
+    }
+
+    // walk the document, one step at a time
+    pathPos = startPos;
+    while (pathPos < pathLength) {
+        dpiOson__parsePathStep(path, pathLength, &pathPos, &isIndex,
+                &nameStart, &nameLength, &index, error);
+
+        // the current node must be a container of the right type
+        containerOffset = decoder->pos - decoder->treeSegPos;
+        if (dpiOson__readUInt8(decoder, &nodeType, error) < 0)
+            return DPI_FAILURE;
+        if (!(nodeType & 0x80) || (isIndex && !(nodeType & 0x40)) ||
+                (!isIndex && (nodeType & 0x40)))
+            return DPI_SUCCESS;
+        if (dpiOson__getContainerInfo(decoder, nodeType, &numChildren,
+                &fieldIdsPos, &offsetsPos, error) < 0)
+            return DPI_FAILURE;
+
+        // determine which child is identified by the path
+        if (isIndex) {
+            if (index >= numChildren)
+                return DPI_SUCCESS;
+            i = index;
+        } else {
+            for (i = 0; i < numChildren; i++) {
+                if (dpiOson__getFieldId(decoder, fieldIdsPos, i, &fieldId,
+                        error) < 0)
+                    return DPI_FAILURE;
+                if (decoder->fieldNameLengths[fieldId - 1] == nameLength &&
+                        memcmp(decoder->fieldNames[fieldId - 1],
+                                path + nameStart, nameLength) == 0)
+                    break;
+            }
+            if (i == numChildren)
+                return DPI_SUCCESS;
+        }
+        if (dpiOson__moveToChild(decoder, nodeType, containerOffset,
+                offsetsPos, i, error) < 0)
+            return DPI_FAILURE;
+
+    }
+
+    *found = 1;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__getContainerInfo() [INTERNAL]
+//   Determine the number of children of an object or array node and the
+// positions of the field id array (objects only) and the child offset array.
+// Objects with the same set of fields may share the field id array of
+// another object in the tree segment.
+//-----------------------------------------------------------------------------
+static int dpiOson__getContainerInfo(dpiOsonDecoder *decoder,
+        uint8_t nodeType, uint32_t *numChildren, uint32_t *fieldIdsPos,
+        uint32_t *offsetsPos, dpiError *error)
+{
+    uint8_t sharedNodeType;
+    uint32_t offset;
+    uint16_t temp16;
+    uint8_t temp8;
+
+    // the number of children is identified by the 4th and 5th bits
+    *fieldIdsPos = 0;
+    switch (nodeType & 0x18) {
+        case 0x00:
+            if (dpiOson__readUInt8(decoder, &temp8, error) < 0)
+                return DPI_FAILURE;
+            *numChildren = temp8;
+            break;
+        case 0x08:
+            if (dpiOson__readUInt16(decoder, &temp16, error) < 0)
+                return DPI_FAILURE;
+            *numChildren = temp16;
+            break;
+        case 0x10:
+            if (dpiOson__readUInt32(decoder, numChildren, error) < 0)
+                return DPI_FAILURE;
+            break;
+        default:
+
+            // shared field ids (objects only)
+            if (nodeType & 0x40)
+                return dpiError__set(error, "check shared array",
+                        DPI_ERR_INVALID_OSON, decoder->pos - 1);
+            if (nodeType & 0x20) {
+                if (dpiOson__readUInt32(decoder, &offset, error) < 0)
+                    return DPI_FAILURE;
+            } else {
+                if (dpiOson__readUInt16(decoder, &temp16, error) < 0)
+                    return DPI_FAILURE;
+                offset = temp16;
+            }
+            *offsetsPos = decoder->pos;
+            if (offset >= decoder->dataLength - decoder->treeSegPos)
+                return dpiError__set(error, "check shared offset",
+                        DPI_ERR_INVALID_OSON, decoder->pos);
+            decoder->pos = decoder->treeSegPos + offset;
+            if (dpiOson__readUInt8(decoder, &sharedNodeType, error) < 0)
+                return DPI_FAILURE;
+            if ((sharedNodeType & 0x18) == 0x18)
+                return dpiError__set(error, "check shared node",
+                        DPI_ERR_INVALID_OSON, decoder->pos - 1);
+            return dpiOson__getContainerInfo(decoder, sharedNodeType,
+                    numChildren, fieldIdsPos, &offset, error);
+    }
+
+    // each child requires at least two bytes for its offset
+    if (*numChildren > (decoder->dataLength - decoder->pos) / 2)
+        return dpiError__set(error, "check number of children",
+                DPI_ERR_INVALID_OSON, decoder->pos);
+    if (nodeType & 0x40) {
+        *offsetsPos = decoder->pos;
+    } else {
+        *fieldIdsPos = decoder->pos;
+        *offsetsPos = decoder->pos + decoder->fieldIdLength * *numChildren;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__getFieldId() [INTERNAL]
+//   Return the field id of the given child of an object. Field ids start
+// from 1 and are verified to refer to a known field name.
+//-----------------------------------------------------------------------------
+static int dpiOson__getFieldId(dpiOsonDecoder *decoder, uint32_t fieldIdsPos,
+        uint32_t index, uint32_t *fieldId, dpiError *error)
+{
+    uint16_t temp16;
+    uint8_t temp8;
+
+    decoder->pos = fieldIdsPos;
+    if (dpiOson__readBytes(decoder,
+            (uint64_t) index * decoder->fieldIdLength, NULL, error) < 0)
+        return DPI_FAILURE;
+    switch (decoder->fieldIdLength) {
+        case 1:
+            if (dpiOson__readUInt8(decoder, &temp8, error) < 0)
+                return DPI_FAILURE;
+            *fieldId = temp8;
+            break;
+        case 2:
+            if (dpiOson__readUInt16(decoder, &temp16, error) < 0)
+                return DPI_FAILURE;
+            *fieldId = temp16;
+            break;
+        default:
+            if (dpiOson__readUInt32(decoder, fieldId, error) < 0)
+                return DPI_FAILURE;
+            break;
+    }
+    if (*fieldId == 0 || *fieldId > decoder->numFieldNames)
+        return dpiError__set(error, "check field id", DPI_ERR_INVALID_OSON,
+                decoder->pos - decoder->fieldIdLength);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__getFieldNames() [INTERNAL]
+//   Populate the field names from the field names segment. The segment is
+// preceded by an array of hash ids (which are not needed) and an array of
+// offsets into the segment. Each name is preceded by its length.
+//-----------------------------------------------------------------------------
+static int dpiOson__getFieldNames(dpiOsonDecoder *decoder,
+        uint32_t startIndex, uint32_t numNames, uint32_t hashIdLength,
+        uint32_t offsetLength, uint32_t segSize, dpiError *error)
+{
+    uint32_t i, offset, nameLength, offsetsPos, finalPos;
+    const uint8_t *seg;
+    uint16_t temp16;
+
+    // skip the hash ids and offsets and acquire the segment
+    if (dpiOson__readBytes(decoder, (uint64_t) numNames * hashIdLength, NULL,
+            error) < 0)
+        return DPI_FAILURE;
+    offsetsPos = decoder->pos;
+    if (dpiOson__readBytes(decoder, (uint64_t) numNames * offsetLength, NULL,
+            error) < 0)
+        return DPI_FAILURE;
+    if (dpiOson__readBytes(decoder, segSize, &seg, error) < 0)
+        return DPI_FAILURE;
+    finalPos = decoder->pos;
+
+    // determine the names of the fields
+    decoder->pos = offsetsPos;
+    for (i = 0; i < numNames; i++) {
+        if (offsetLength == 2) {
+            if (dpiOson__readUInt16(decoder, &temp16, error) < 0)
+                return DPI_FAILURE;
+            offset = temp16;
+        } else if (dpiOson__readUInt32(decoder, &offset, error) < 0) {
+            return DPI_FAILURE;
+        }
+        if ((uint64_t) offset + hashIdLength > segSize)
+            return dpiError__set(error, "check field name offset",
+                    DPI_ERR_INVALID_OSON, decoder->pos - offsetLength);
+        nameLength = seg[offset];
+        if (hashIdLength == 2)
+            nameLength = (nameLength << 8) | seg[offset + 1];
+        if ((uint64_t) offset + hashIdLength + nameLength > segSize)
+            return dpiError__set(error, "check field name length",
+                    DPI_ERR_INVALID_OSON, decoder->pos - offsetLength);
+        decoder->fieldNames[startIndex + i] =
+                (const char*) seg + offset + hashIdLength;
+        decoder->fieldNameLengths[startIndex + i] = nameLength;
+    }
+    decoder->pos = finalPos;
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__moveToChild() [INTERNAL]
+//   Position the decoder at the given child of an object or array. The child
+// offsets are two or four bytes in size, depending on the node type, and may
+// be relative to the position of the container. Children always follow their
+// container so an offset that does not is rejected; this ensures that
+// malformed data cannot refer back to a container from within itself.
+//-----------------------------------------------------------------------------
+static int dpiOson__moveToChild(dpiOsonDecoder *decoder, uint8_t nodeType,
+        uint32_t containerOffset, uint32_t offsetsPos, uint32_t index,
+        dpiError *error)
+{
+    uint64_t childOffset;
+    uint32_t offset;
+    uint16_t temp16;
+
+    decoder->pos = offsetsPos;
+    if (nodeType & 0x20) {
+        if (dpiOson__readBytes(decoder, (uint64_t) index * 4, NULL,
+                error) < 0)
+            return DPI_FAILURE;
+        if (dpiOson__readUInt32(decoder, &offset, error) < 0)
+            return DPI_FAILURE;
+    } else {
+        if (dpiOson__readBytes(decoder, (uint64_t) index * 2, NULL,
+                error) < 0)
+            return DPI_FAILURE;
+        if (dpiOson__readUInt16(decoder, &temp16, error) < 0)
+            return DPI_FAILURE;
+        offset = temp16;
+    }
+    childOffset = offset;
+    if (decoder->relativeOffsets)
+        childOffset += containerOffset;
+    if (childOffset <= containerOffset ||
+            childOffset >= decoder->dataLength - decoder->treeSegPos)
+        return dpiError__set(error, "check child offset",
+                DPI_ERR_INVALID_OSON, decoder->pos);
+    decoder->pos = decoder->treeSegPos + (uint32_t) childOffset;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__parsePathStep() [INTERNAL]
+//   Parse the step of the path at the given position, which is either an
+// array index enclosed in square brackets or a field name (preceded by a
+// period unless it is the first step of the path). The position is advanced
+// past the step.
+//-----------------------------------------------------------------------------
+static int dpiOson__parsePathStep(const char *path, uint32_t pathLength,
+        uint32_t *pathPos, int *isIndex, uint32_t *nameStart,
+        uint32_t *nameLength, uint32_t *index, dpiError *error)
+{
+    uint32_t pos = *pathPos;
+
+    // array index
+    if (path[pos] == '[') {
+        *nameStart = ++pos;
+        for (*index = 0; pos < pathLength && path[pos] >= '0' &&
+                path[pos] <= '9'; pos++) {
+            if (*index > 429496728)
+                return dpiError__set(error, "check array index",
+                        DPI_ERR_INVALID_JSON_PATH, pos);
+            *index = *index * 10 + (uint32_t) (path[pos] - '0');
+        }
+        if (pos == *nameStart || pos == pathLength || path[pos] != ']')
+            return dpiError__set(error, "check array index",
+                    DPI_ERR_INVALID_JSON_PATH, pos);
+        *pathPos = pos + 1;
+        *isIndex = 1;
+        return DPI_SUCCESS;
+    }
+
+    // field name
+    if (path[pos] == '.') {
+        pos++;
+    } else if (pos > 0) {
+        return dpiError__set(error, "check field name",
+                DPI_ERR_INVALID_JSON_PATH, pos);
+    }
+    *nameStart = pos;
+    while (pos < pathLength && path[pos] != '.' && path[pos] != '[' &&
+            path[pos] != ']')
+        pos++;
+    *nameLength = pos - *nameStart;
+    if (*nameLength == 0)
+        return dpiError__set(error, "check field name",
+                DPI_ERR_INVALID_JSON_PATH, pos);
+    *pathPos = pos;
+    *isIndex = 0;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__readBytes() [INTERNAL]
+//   Return a pointer to the given number of bytes at the current position and
+// advance past them. If the pointer is NULL, the bytes are simply skipped. An
+// error is raised if insufficient data remains.
+//-----------------------------------------------------------------------------
+static int dpiOson__readBytes(dpiOsonDecoder *decoder, uint64_t length,
+        const uint8_t **ptr, dpiError *error)
+{
+    if (ptr)
+        *ptr = decoder->data + decoder->pos;
+    if (length > decoder->dataLength - decoder->pos)
+        return dpiError__set(error, "read OSON bytes", DPI_ERR_INVALID_OSON,
+                decoder->pos);
+    decoder->pos += (uint32_t) length;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__readUInt8() [INTERNAL]
+//   Read an unsigned 8-bit integer at the current position.
+//-----------------------------------------------------------------------------
+static int dpiOson__readUInt8(dpiOsonDecoder *decoder, uint8_t *value,
+        dpiError *error)
+{
+    const uint8_t *ptr;
+
+    if (dpiOson__readBytes(decoder, 1, &ptr, error) < 0)
+        return DPI_FAILURE;
+    *value = ptr[0];
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__readUInt16() [INTERNAL]
+//   Read an unsigned 16-bit big endian integer at the current position.
+//-----------------------------------------------------------------------------
+static int dpiOson__readUInt16(dpiOsonDecoder *decoder, uint16_t *value,
+        dpiError *error)
+{
+    const uint8_t *ptr;
+
+    if (dpiOson__readBytes(decoder, 2, &ptr, error) < 0)
+        return DPI_FAILURE;
+    *value = (uint16_t) ((ptr[0] << 8) | ptr[1]);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiOson__readUInt32() [INTERNAL]
+//   Read an unsigned 32-bit big endian integer at the current position.
+//-----------------------------------------------------------------------------
+static int dpiOson__readUInt32(dpiOsonDecoder *decoder, uint32_t *value,
+        dpiError *error)
+{
+    const uint8_t *ptr;
+
+    if (dpiOson__readBytes(decoder, 4, &ptr, error) < 0)
+        return DPI_FAILURE;
+    *value = ((uint32_t) ptr[0] << 24) | ((uint32_t) ptr[1] << 16) |
+            ((uint32_t) ptr[2] << 8) | ptr[3];
+    return DPI_SUCCESS;
+}
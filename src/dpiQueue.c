@@ -35,6 +35,9 @@ static int dpiQueue__allocateBuffer(dpiQueue *queue, uint32_t numElements,
 static int dpiQueue__deq(dpiQueue *queue, uint32_t *numProps,
         dpiMsgProps **props, dpiError *error);
 static void dpiQueue__freeBuffer(dpiQueue *queue, dpiError *error);
+static dpiMsgProps *dpiQueue__getRecycledMsgProps(dpiQueue *queue);
+static int dpiQueue__populateDeqBuffer(dpiQueue *queue, uint32_t numProps,
+        dpiError *error);
 static int dpiQueue__getPayloadTDO(dpiQueue *queue, void **tdo,
         dpiError *error);
 
@@ -54,6 +57,7 @@ int dpiQueue__allocate(dpiConn *conn, const char *name, uint32_t nameLength,
     if (dpiGen__allocate(DPI_HTYPE_QUEUE, conn->env, (void**) &tempQueue,
             error) < 0)
         return DPI_FAILURE;
+    dpiMutex__initialize(tempQueue->mutex);
     dpiGen__setRefCount(conn, error, 1);
     tempQueue->conn = conn;
     tempQueue->isJson = isJson;
@@ -77,6 +81,14 @@ int dpiQueue__allocate(dpiConn *conn, const char *name, uint32_t nameLength,
     buffer[nameLength] = '\0';
     tempQueue->name = buffer;
 
+    // add the queue to the list of queues created by the connection so that
+    // any pending dequeue can be abandoned when execution is broken
+    if (dpiHandleList__addHandle(conn->openQueues, tempQueue,
+            &tempQueue->openSlotNum, error) < 0) {
+        dpiQueue__free(tempQueue, error);
+        return DPI_FAILURE;
+    }
+
     *queue = tempQueue;
     return DPI_SUCCESS;
 }
@@ -123,6 +135,36 @@ static int dpiQueue__allocateBuffer(dpiQueue *queue, uint32_t numElements,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiQueue__allocateRecycledProps() [INTERNAL]
+//   Ensure there is enough space to hold the specified number of message
+// properties that have been released and are available for reuse.
+//-----------------------------------------------------------------------------
+static int dpiQueue__allocateRecycledProps(dpiQueue *queue,
+        uint32_t numElements, dpiError *error)
+{
+    dpiMsgProps **tempProps, **oldProps;
+
+    if (dpiUtils__allocateMemory(numElements, sizeof(dpiMsgProps*), 1,
+            "allocate recycled msg props array", (void**) &tempProps,
+            error) < 0)
+        return DPI_FAILURE;
+    if (queue->env->threaded)
+        dpiMutex__acquire(queue->env->mutex);
+    oldProps = queue->recycledProps;
+    if (oldProps)
+        memcpy(tempProps, oldProps,
+                queue->numRecycledProps * sizeof(dpiMsgProps*));
+    queue->recycledProps = tempProps;
+    queue->maxRecycledProps = numElements;
+    if (queue->env->threaded)
+        dpiMutex__release(queue->env->mutex);
+    if (oldProps)
+        dpiUtils__freeMemory(oldProps);
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiQueue__check() [INTERNAL]
 //   Determine if the queue is available to use.
@@ -138,6 +180,37 @@ static int dpiQueue__check(dpiQueue *queue, const char *fnName,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiQueue__checkPayload() [INTERNAL]
+//   Determine if the message properties have a payload of the type required
+// by the queue.
+//-----------------------------------------------------------------------------
+static int dpiQueue__checkPayload(dpiQueue *queue, dpiMsgProps *props,
+        dpiError *error)
+{
+    if (!props->payloadObj && !props->payloadRaw && !props->payloadJson)
+        return dpiError__set(error, "check payload",
+                DPI_ERR_QUEUE_NO_PAYLOAD);
+    if ((queue->isJson && !props->payloadJson) ||
+            (queue->payloadType && !props->payloadObj) ||
+            (!queue->isJson && !queue->payloadType && !props->payloadRaw))
+        return dpiError__set(error, "check payload",
+                DPI_ERR_QUEUE_WRONG_PAYLOAD_TYPE);
+    if (queue->payloadType && props->payloadObj &&
+            queue->payloadType->tdo != props->payloadObj->type->tdo)
+        return dpiError__set(error, "check payload", DPI_ERR_WRONG_TYPE,
+                props->payloadObj->type->schemaLength,
+                props->payloadObj->type->schema,
+                props->payloadObj->type->nameLength,
+                props->payloadObj->type->name,
+                queue->payloadType->schemaLength,
+                queue->payloadType->schema,
+                queue->payloadType->nameLength,
+                queue->payloadType->name);
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiQueue__createDeqOptions() [INTERNAL]
 //   Create the dequeue options object that will be used for performing
@@ -184,70 +257,45 @@ static int dpiQueue__createEnqOptions(dpiQueue *queue, dpiError *error)
 
 //-----------------------------------------------------------------------------
 // dpiQueue__deq() [INTERNAL]
-//   Perform a dequeue of up to the specified number of properties.
+//   Perform a dequeue of up to the specified number of properties. If the
+// connection is in non-blocking mode and the dequeue has not yet completed,
+// the state of the dequeue is retained so that it can be continued by calling
+// this function again.
 //-----------------------------------------------------------------------------
 static int dpiQueue__deq(dpiQueue *queue, uint32_t *numProps,
         dpiMsgProps **props, dpiError *error)
 {
-    dpiMsgProps *prop;
+    uint32_t i, pos, requestedNumProps;
     void *payloadTDO;
-    uint32_t i;
     int status;
 
-    // create dequeue options, if necessary
-    if (!queue->deqOptions && dpiQueue__createDeqOptions(queue, error) < 0)
+    // acquire the payload TDO and server version before the buffer is
+    // populated as these may require round trips of their own
+    if (dpiQueue__getPayloadTDO(queue, &payloadTDO, error) < 0)
         return DPI_FAILURE;
-
-    // allocate buffer, if necessary
-    if (queue->buffer.numElements < *numProps &&
-            dpiQueue__allocateBuffer(queue, *numProps, error) < 0)
+    if (dpiConn__getServerVersion(queue->conn, 0, error) < 0)
         return DPI_FAILURE;
 
-    // populate buffer
-    for (i = 0; i < *numProps; i++) {
-        prop = queue->buffer.props[i];
-
-        // create new message properties, if applicable
-        if (!prop) {
-            if (dpiMsgProps__allocate(queue->conn, &prop, error) < 0)
-                return DPI_FAILURE;
-            queue->buffer.props[i] = prop;
-        }
-
-        // create payload object, if applicable
-        if (queue->payloadType && !prop->payloadObj &&
-                dpiObject__allocate(queue->payloadType, NULL, NULL, NULL,
-                &prop->payloadObj, error) < 0)
-            return DPI_FAILURE;
-
-        // create JSON payload object, if applicable
-        if (queue->isJson) {
-            if (dpiJson__allocate(queue->conn, NULL, &prop->payloadJson,
-                    error) < 0)
-                return DPI_FAILURE;
-        }
-
-        // set OCI arrays
-        queue->buffer.handles[i] = prop->handle;
-        if (queue->payloadType) {
-            queue->buffer.instances[i] = prop->payloadObj->instance;
-            queue->buffer.indicators[i] = prop->payloadObj->indicator;
-        } else if (queue->isJson) {
-            queue->buffer.instances[i] = prop->payloadJson->handle;
-            queue->buffer.indicators[i] = &queue->buffer.scalarIndicators[i];
-        } else {
-            queue->buffer.instances[i] = prop->payloadRaw;
-            queue->buffer.indicators[i] = &queue->buffer.scalarIndicators[i];
-        }
-        queue->buffer.msgIds[i] = prop->msgIdRaw;
-
+    // populate the buffer, unless a dequeue that was still executing in
+    // non-blocking mode is being continued, in which case the buffer that was
+    // populated by the original call is used; a pending dequeue is abandoned
+    // if the connection has since been returned to blocking mode (it is also
+    // abandoned by dpiConn_breakExecution())
+    pos = 0;
+    if (queue->deqPending && !queue->conn->nonBlocking)
+        queue->deqPending = 0;
+    if (queue->deqPending) {
+        if (*numProps < queue->deqPendingNumProps)
+            return dpiError__set(error, "check array size",
+                    DPI_ERR_ARRAY_SIZE_TOO_SMALL, *numProps);
+        *numProps = queue->deqPendingNumProps;
+        pos = queue->deqPendingPos;
+    } else if (dpiQueue__populateDeqBuffer(queue, *numProps, error) < 0) {
+        return DPI_FAILURE;
     }
 
     // perform dequeue
-    if (dpiQueue__getPayloadTDO(queue, &payloadTDO, error) < 0)
-        return DPI_FAILURE;
-    if (dpiConn__getServerVersion(queue->conn, 0, error) < 0)
-        return DPI_FAILURE;
+    requestedNumProps = *numProps;
     if (*numProps == 1) {
         status = dpiOci__aqDeq(queue->conn, queue->name,
                 queue->deqOptions->handle, queue->buffer.handles[0],
@@ -257,13 +305,14 @@ static int dpiQueue__deq(dpiQueue *queue, uint32_t *numProps,
             *numProps = 0;
     } else if (queue->isJson && queue->conn->versionInfo.versionNum < 23) {
         status = DPI_SUCCESS;
-        for (i = 0; i < *numProps; i++) {
+        for (i = pos; i < *numProps; i++) {
             status = dpiOci__aqDeq(queue->conn, queue->name,
                     queue->deqOptions->handle, queue->buffer.handles[i],
                     payloadTDO, &queue->buffer.instances[i],
                     &queue->buffer.indicators[i],
                     &queue->buffer.msgIds[i], error);
             if (status < 0) {
+                pos = i;
                 *numProps = i;
                 break;
             }
@@ -274,15 +323,26 @@ static int dpiQueue__deq(dpiQueue *queue, uint32_t *numProps,
                 payloadTDO, queue->buffer.instances, queue->buffer.indicators,
                 queue->buffer.msgIds, error);
     }
+    if (status < 0 && error->buffer->errorNum == DPI_ERR_STILL_EXECUTING) {
+        queue->deqPending = 1;
+        queue->deqPendingNumProps = requestedNumProps;
+        queue->deqPendingPos = pos;
+        *numProps = 0;
+        return DPI_FAILURE;
+    }
+    queue->deqPending = 0;
     if (status < 0 && error->buffer->code != 25228) {
         error->buffer->offset = *numProps;
         return DPI_FAILURE;
     }
 
-    // transfer message properties to destination array
+    // transfer message properties to destination array; each retains a
+    // reference to the queue so that it can be recycled when released
     for (i = 0; i < *numProps; i++) {
         props[i] = queue->buffer.props[i];
         queue->buffer.props[i] = NULL;
+        dpiGen__setRefCount(queue, error, 1);
+        props[i]->queue = queue;
         if (queue->isJson) {
             props[i]->payloadJson->handle = queue->buffer.instances[i];
         } else if (!queue->payloadType) {
@@ -304,6 +364,7 @@ static int dpiQueue__enq(dpiQueue *queue, uint32_t numProps,
 {
     void *payloadTDO;
     uint32_t i;
+    int status;
 
     // if no messages are being enqueued, nothing to do!
     if (numProps == 0)
@@ -322,28 +383,8 @@ static int dpiQueue__enq(dpiQueue *queue, uint32_t numProps,
     for (i = 0; i < numProps; i++) {
 
         // perform checks
-        if (!props[i]->payloadObj && !props[i]->payloadRaw &&
-                !props[i]->payloadJson)
-            return dpiError__set(error, "check payload",
-                    DPI_ERR_QUEUE_NO_PAYLOAD);
-        if ((queue->isJson && !props[i]->payloadJson) ||
-                (queue->payloadType && !props[i]->payloadObj) ||
-                (!queue->isJson && !queue->payloadType &&
-                        !props[i]->payloadRaw))
-            return dpiError__set(error, "check payload",
-                    DPI_ERR_QUEUE_WRONG_PAYLOAD_TYPE);
-        if (queue->payloadType && props[i]->payloadObj &&
-                queue->payloadType->tdo != props[i]->payloadObj->type->tdo)
-            return dpiError__set(error, "check payload",
-                    DPI_ERR_WRONG_TYPE,
-                    props[i]->payloadObj->type->schemaLength,
-                    props[i]->payloadObj->type->schema,
-                    props[i]->payloadObj->type->nameLength,
-                    props[i]->payloadObj->type->name,
-                    queue->payloadType->schemaLength,
-                    queue->payloadType->schema,
-                    queue->payloadType->nameLength,
-                    queue->payloadType->name);
+        if (dpiQueue__checkPayload(queue, props[i], error) < 0)
+            return DPI_FAILURE;
 
         // set OCI arrays
         queue->buffer.handles[i] = props[i]->handle;
@@ -365,25 +406,61 @@ static int dpiQueue__enq(dpiQueue *queue, uint32_t numProps,
     if (dpiQueue__getPayloadTDO(queue, &payloadTDO, error) < 0)
         return DPI_FAILURE;
     if (numProps == 1) {
-        if (dpiOci__aqEnq(queue->conn, queue->name, queue->enqOptions->handle,
-                queue->buffer.handles[0], payloadTDO, queue->buffer.instances,
-                queue->buffer.indicators, queue->buffer.msgIds, error) < 0)
-            return DPI_FAILURE;
+        status = dpiOci__aqEnq(queue->conn, queue->name,
+                queue->enqOptions->handle, queue->buffer.handles[0],
+                payloadTDO, queue->buffer.instances, queue->buffer.indicators,
+                queue->buffer.msgIds, error);
+        if (status < 0)
+            numProps = 0;
     } else {
-        if (dpiOci__aqEnqArray(queue->conn, queue->name,
+        status = dpiOci__aqEnqArray(queue->conn, queue->name,
                 queue->enqOptions->handle, &numProps, queue->buffer.handles,
                 payloadTDO, queue->buffer.instances, queue->buffer.indicators,
-                queue->buffer.msgIds, error) < 0) {
+                queue->buffer.msgIds, error);
+        if (status < 0)
             error->buffer->offset = numProps;
-            return DPI_FAILURE;
-        }
     }
 
-    // transfer message ids back to message properties
+    // transfer message ids back to message properties; if the enqueue failed
+    // part way through, only the messages that were enqueued have one
     for (i = 0; i < numProps; i++)
         props[i]->msgIdRaw = queue->buffer.msgIds[i];
 
-    return DPI_SUCCESS;
+    return status;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiQueue__flushEnqBatch() [INTERNAL]
+//   Enqueue the messages in the batch using a single array enqueue and then
+// release them from the batch, whether or not the enqueue succeeded. The
+// message ids of the messages are cleared beforehand so that the messages
+// which were not enqueued can be identified by their lack of a message id.
+// The queue lock is expected to be held.
+//-----------------------------------------------------------------------------
+static int dpiQueue__flushEnqBatch(dpiQueue *queue, dpiError *error)
+{
+    dpiMsgProps *props;
+    uint32_t i;
+    int status;
+
+    if (queue->enqBatchNumProps == 0)
+        return DPI_SUCCESS;
+    for (i = 0; i < queue->enqBatchNumProps; i++) {
+        props = queue->enqBatch[i];
+        if (props->msgIdRaw) {
+            dpiOci__rawResize(props->env->handle, &props->msgIdRaw, 0, error);
+            props->msgIdRaw = NULL;
+        }
+    }
+    status = dpiQueue__enq(queue, queue->enqBatchNumProps, queue->enqBatch,
+            error);
+    for (i = 0; i < queue->enqBatchNumProps; i++) {
+        dpiGen__setRefCount(queue->enqBatch[i], error, -1);
+        queue->enqBatch[i] = NULL;
+    }
+    queue->enqBatchNumProps = 0;
+    return status;
 }
 
 
@@ -393,7 +470,11 @@ static int dpiQueue__enq(dpiQueue *queue, uint32_t numProps,
 //-----------------------------------------------------------------------------
 void dpiQueue__free(dpiQueue *queue, dpiError *error)
 {
+    uint32_t i;
+
     if (queue->conn) {
+        dpiHandleList__removeHandle(queue->conn->openQueues,
+                queue->openSlotNum);
         dpiGen__setRefCount(queue->conn, error, -1);
         queue->conn = NULL;
     }
@@ -414,6 +495,19 @@ void dpiQueue__free(dpiQueue *queue, dpiError *error)
         queue->enqOptions = NULL;
     }
     dpiQueue__freeBuffer(queue, error);
+    if (queue->enqBatch) {
+        for (i = 0; i < queue->enqBatchNumProps; i++)
+            dpiGen__setRefCount(queue->enqBatch[i], error, -1);
+        dpiUtils__freeMemory(queue->enqBatch);
+        queue->enqBatch = NULL;
+    }
+    dpiMutex__destroy(queue->mutex);
+    if (queue->recycledProps) {
+        for (i = 0; i < queue->numRecycledProps; i++)
+            dpiMsgProps__free(queue->recycledProps[i], error);
+        dpiUtils__freeMemory(queue->recycledProps);
+        queue->recycledProps = NULL;
+    }
     dpiUtils__freeMemory(queue);
 }
 
@@ -485,6 +579,142 @@ static int dpiQueue__getPayloadTDO(dpiQueue *queue, void **tdo,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiQueue__getRecycledMsgProps() [INTERNAL]
+//   Return message properties that were released and are available for
+// reuse, or NULL if there are none. The returned message properties are
+// made valid again with a single reference.
+//-----------------------------------------------------------------------------
+static dpiMsgProps *dpiQueue__getRecycledMsgProps(dpiQueue *queue)
+{
+    dpiMsgProps *props = NULL;
+
+    if (queue->env->threaded)
+        dpiMutex__acquire(queue->env->mutex);
+    if (queue->numRecycledProps > 0)
+        props = queue->recycledProps[--queue->numRecycledProps];
+    if (queue->env->threaded)
+        dpiMutex__release(queue->env->mutex);
+    if (props) {
+        props->checkInt = props->typeDef->checkInt;
+        props->refCount = 1;
+    }
+    return props;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiQueue__populateDeqBuffer() [INTERNAL]
+//   Populate the buffer with the message properties and payloads into which
+// the specified number of messages will be dequeued.
+//-----------------------------------------------------------------------------
+static int dpiQueue__populateDeqBuffer(dpiQueue *queue, uint32_t numProps,
+        dpiError *error)
+{
+    dpiMsgProps *prop;
+    uint32_t i;
+
+    // create dequeue options, if necessary
+    if (!queue->deqOptions && dpiQueue__createDeqOptions(queue, error) < 0)
+        return DPI_FAILURE;
+
+    // allocate buffer, if necessary
+    if (queue->buffer.numElements < numProps &&
+            dpiQueue__allocateBuffer(queue, numProps, error) < 0)
+        return DPI_FAILURE;
+
+    // allocate space for recycled message properties, if necessary
+    if (queue->maxRecycledProps < numProps &&
+            dpiQueue__allocateRecycledProps(queue, numProps, error) < 0)
+        return DPI_FAILURE;
+
+    // populate buffer
+    for (i = 0; i < numProps; i++) {
+        prop = queue->buffer.props[i];
+
+        // reuse released message properties or create new ones, if applicable
+        if (!prop) {
+            prop = dpiQueue__getRecycledMsgProps(queue);
+            if (!prop && dpiMsgProps__allocate(queue->conn, &prop,
+                    error) < 0)
+                return DPI_FAILURE;
+            queue->buffer.props[i] = prop;
+        }
+
+        // create payload object, if applicable
+        if (queue->payloadType && !prop->payloadObj &&
+                dpiObject__allocate(queue->payloadType, NULL, NULL, NULL,
+                &prop->payloadObj, error) < 0)
+            return DPI_FAILURE;
+
+        // create JSON payload object, if applicable
+        if (queue->isJson) {
+            if (dpiJson__allocate(queue->conn, NULL, &prop->payloadJson,
+                    error) < 0)
+                return DPI_FAILURE;
+        }
+
+        // set OCI arrays
+        queue->buffer.handles[i] = prop->handle;
+        if (queue->payloadType) {
+            queue->buffer.instances[i] = prop->payloadObj->instance;
+            queue->buffer.indicators[i] = prop->payloadObj->indicator;
+        } else if (queue->isJson) {
+            queue->buffer.instances[i] = prop->payloadJson->handle;
+            queue->buffer.indicators[i] = &queue->buffer.scalarIndicators[i];
+        } else {
+            queue->buffer.instances[i] = prop->payloadRaw;
+            queue->buffer.indicators[i] = &queue->buffer.scalarIndicators[i];
+        }
+        queue->buffer.msgIds[i] = prop->msgIdRaw;
+
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiQueue__recycleMsgProps() [INTERNAL]
+//   Called when the last reference to message properties returned by a
+// dequeue is released. Payloads that cannot be reused are released and the
+// message properties are retained for reuse by a later dequeue if there is
+// space available. Returns DPI_FAILURE if the message properties were not
+// retained and should be freed by the caller.
+//-----------------------------------------------------------------------------
+int dpiQueue__recycleMsgProps(dpiQueue *queue, dpiMsgProps *props,
+        dpiError *error)
+{
+    int recycled = 0;
+
+    // the payload object is reused only if it is of the queue's payload type
+    // and no other references to it are held by the application; JSON
+    // payloads are always replaced by a dequeue
+    if (props->payloadObj && (props->payloadObj->refCount > 1 ||
+            !queue->payloadType ||
+            props->payloadObj->type->tdo != queue->payloadType->tdo)) {
+        dpiGen__setRefCount(props->payloadObj, error, -1);
+        props->payloadObj = NULL;
+    }
+    if (props->payloadJson) {
+        dpiGen__setRefCount(props->payloadJson, error, -1);
+        props->payloadJson = NULL;
+    }
+
+    // retain the message properties if there is space available
+    if (queue->env->threaded)
+        dpiMutex__acquire(queue->env->mutex);
+    if (queue->numRecycledProps < queue->maxRecycledProps) {
+        queue->recycledProps[queue->numRecycledProps++] = props;
+        recycled = 1;
+    }
+    if (queue->env->threaded)
+        dpiMutex__release(queue->env->mutex);
+
+    return (recycled) ? DPI_SUCCESS : DPI_FAILURE;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiQueue_addRef() [PUBLIC]
 //   Add a reference to the queue.
@@ -508,7 +738,9 @@ int dpiQueue_deqMany(dpiQueue *queue, uint32_t *numProps, dpiMsgProps **props)
         return dpiGen__endPublicFn(queue, DPI_FAILURE, &error);
     DPI_CHECK_PTR_NOT_NULL(queue, numProps)
     DPI_CHECK_PTR_NOT_NULL(queue, props)
+    dpiMutex__acquire(queue->mutex);
     status = dpiQueue__deq(queue, numProps, props, &error);
+    dpiMutex__release(queue->mutex);
     return dpiGen__endPublicFn(queue, status, &error);
 }
 
@@ -521,11 +753,15 @@ int dpiQueue_deqOne(dpiQueue *queue, dpiMsgProps **props)
 {
     uint32_t numProps = 1;
     dpiError error;
+    int status;
 
     if (dpiQueue__check(queue, __func__, &error) < 0)
         return dpiGen__endPublicFn(queue, DPI_FAILURE, &error);
     DPI_CHECK_PTR_NOT_NULL(queue, props)
-    if (dpiQueue__deq(queue, &numProps, props, &error) < 0)
+    dpiMutex__acquire(queue->mutex);
+    status = dpiQueue__deq(queue, &numProps, props, &error);
+    dpiMutex__release(queue->mutex);
+    if (status < 0)
         return dpiGen__endPublicFn(queue, DPI_FAILURE, &error);
     if (numProps == 0)
         *props = NULL;
@@ -552,7 +788,49 @@ int dpiQueue_enqMany(dpiQueue *queue, uint32_t numProps, dpiMsgProps **props)
                 "check message properties", &error) < 0)
             return dpiGen__endPublicFn(queue, DPI_FAILURE, &error);
     }
+    dpiMutex__acquire(queue->mutex);
     status = dpiQueue__enq(queue, numProps, props, &error);
+    dpiMutex__release(queue->mutex);
+    return dpiGen__endPublicFn(queue, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiQueue_enqBatched() [PUBLIC]
+//   Add a message to the batch of messages to be enqueued. The batch is
+// enqueued when it reaches the configured size or when the first message in
+// the batch has been waiting for longer than the configured delay. If batching
+// has not been configured, the message is enqueued immediately.
+//-----------------------------------------------------------------------------
+int dpiQueue_enqBatched(dpiQueue *queue, dpiMsgProps *props)
+{
+    dpiError error;
+    uint64_t now;
+    int status;
+
+    if (dpiQueue__check(queue, __func__, &error) < 0)
+        return dpiGen__endPublicFn(queue, DPI_FAILURE, &error);
+    if (dpiGen__checkHandle(props, DPI_HTYPE_MSG_PROPS,
+            "check message properties", &error) < 0)
+        return dpiGen__endPublicFn(queue, DPI_FAILURE, &error);
+    if (dpiQueue__checkPayload(queue, props, &error) < 0)
+        return dpiGen__endPublicFn(queue, DPI_FAILURE, &error);
+    status = DPI_SUCCESS;
+    dpiMutex__acquire(queue->mutex);
+    if (queue->enqBatchMaxMessages == 0) {
+        status = dpiQueue__enq(queue, 1, &props, &error);
+    } else {
+        now = dpiUtils__getMilliseconds();
+        if (queue->enqBatchNumProps == 0)
+            queue->enqBatchStartTime = now;
+        dpiGen__setRefCount(props, &error, 1);
+        queue->enqBatch[queue->enqBatchNumProps++] = props;
+        if (queue->enqBatchNumProps == queue->enqBatchMaxMessages ||
+                (queue->enqBatchMaxDelay > 0 &&
+                now - queue->enqBatchStartTime >= queue->enqBatchMaxDelay))
+            status = dpiQueue__flushEnqBatch(queue, &error);
+    }
+    dpiMutex__release(queue->mutex);
     return dpiGen__endPublicFn(queue, status, &error);
 }
 
@@ -571,7 +849,27 @@ int dpiQueue_enqOne(dpiQueue *queue, dpiMsgProps *props)
     if (dpiGen__checkHandle(props, DPI_HTYPE_MSG_PROPS,
             "check message properties", &error) < 0)
         return dpiGen__endPublicFn(queue, DPI_FAILURE, &error);
+    dpiMutex__acquire(queue->mutex);
     status = dpiQueue__enq(queue, 1, &props, &error);
+    dpiMutex__release(queue->mutex);
+    return dpiGen__endPublicFn(queue, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiQueue_flushEnq() [PUBLIC]
+//   Enqueue all of the messages in the batch of messages to be enqueued.
+//-----------------------------------------------------------------------------
+int dpiQueue_flushEnq(dpiQueue *queue)
+{
+    dpiError error;
+    int status;
+
+    if (dpiQueue__check(queue, __func__, &error) < 0)
+        return dpiGen__endPublicFn(queue, DPI_FAILURE, &error);
+    dpiMutex__acquire(queue->mutex);
+    status = dpiQueue__flushEnqBatch(queue, &error);
+    dpiMutex__release(queue->mutex);
     return dpiGen__endPublicFn(queue, status, &error);
 }
 
@@ -622,3 +920,37 @@ int dpiQueue_release(dpiQueue *queue)
 {
     return dpiGen__release(queue, DPI_HTYPE_QUEUE, __func__);
 }
+
+
+//-----------------------------------------------------------------------------
+// dpiQueue_setEnqBatching() [PUBLIC]
+//   Set the number of messages and the delay (in milliseconds) at which the
+// batch of messages added by dpiQueue_enqBatched() is enqueued. Any messages
+// already in the batch are enqueued first.
+//-----------------------------------------------------------------------------
+int dpiQueue_setEnqBatching(dpiQueue *queue, uint32_t maxMessages,
+        uint32_t maxDelay)
+{
+    dpiMsgProps **tempBatch = NULL;
+    dpiError error;
+    int status;
+
+    if (dpiQueue__check(queue, __func__, &error) < 0)
+        return dpiGen__endPublicFn(queue, DPI_FAILURE, &error);
+    dpiMutex__acquire(queue->mutex);
+    status = dpiQueue__flushEnqBatch(queue, &error);
+    if (status == DPI_SUCCESS && maxMessages > 0 &&
+            maxMessages != queue->enqBatchMaxMessages)
+        status = dpiUtils__allocateMemory(maxMessages, sizeof(dpiMsgProps*),
+                1, "allocate enqueue batch", (void**) &tempBatch, &error);
+    if (status == DPI_SUCCESS && maxMessages != queue->enqBatchMaxMessages) {
+        if (queue->enqBatch)
+            dpiUtils__freeMemory(queue->enqBatch);
+        queue->enqBatch = tempBatch;
+        queue->enqBatchMaxMessages = maxMessages;
+    }
+    if (status == DPI_SUCCESS)
+        queue->enqBatchMaxDelay = maxDelay;
+    dpiMutex__release(queue->mutex);
+    return dpiGen__endPublicFn(queue, status, &error);
+}
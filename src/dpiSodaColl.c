@@ -30,6 +30,9 @@
 #include "dpiImpl.h"
 
 // forward declarations of internal functions only used in this file
+static int dpiSodaColl__insertMany(dpiSodaColl *coll, uint32_t numDocs,
+        void **docHandles, uint32_t flags, dpiSodaDoc **insertedDocs,
+        void *operOptionsHandle, dpiError *error);
 static int dpiSodaColl__populateOperOptions(dpiSodaColl *coll,
         const dpiSodaOperOptions *options, void *handle, dpiError *error);
 
@@ -51,6 +54,7 @@ int dpiSodaColl__allocate(dpiSodaDb *db, void *handle, dpiSodaColl **coll,
     if (dpiGen__allocate(DPI_HTYPE_SODA_COLL, db->env, (void**) &tempColl,
             error) < 0)
         return DPI_FAILURE;
+    dpiMutex__initialize(tempColl->insertBatchMutex);
     dpiGen__setRefCount(db, error, 1);
     tempColl->db = db;
     tempColl->handle = handle;
@@ -68,6 +72,38 @@ int dpiSodaColl__allocate(dpiSodaDb *db, void *handle, dpiSodaColl **coll,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSodaColl__allocateInsertBatch() [INTERNAL]
+//   Allocate the arrays used for holding the batch of documents to be
+// inserted, replacing any arrays that were previously allocated. The batch is
+// expected to be empty and the batch lock is expected to be held.
+//-----------------------------------------------------------------------------
+static int dpiSodaColl__allocateInsertBatch(dpiSodaColl *coll,
+        uint32_t maxDocs, dpiError *error)
+{
+    void **tempHandles;
+    dpiSodaDoc **tempBatch;
+
+    if (dpiUtils__allocateMemory(maxDocs, sizeof(dpiSodaDoc*), 1,
+            "allocate insert batch", (void**) &tempBatch, error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(maxDocs, sizeof(void*), 1,
+            "allocate insert batch handles", (void**) &tempHandles,
+            error) < 0) {
+        dpiUtils__freeMemory(tempBatch);
+        return DPI_FAILURE;
+    }
+    if (coll->insertBatch)
+        dpiUtils__freeMemory(coll->insertBatch);
+    if (coll->insertBatchHandles)
+        dpiUtils__freeMemory(coll->insertBatchHandles);
+    coll->insertBatch = tempBatch;
+    coll->insertBatchHandles = tempHandles;
+    coll->insertBatchMaxDocs = maxDocs;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSodaColl__check() [INTERNAL]
 //   Determine if the SODA collection is available to use.
@@ -175,6 +211,41 @@ static int dpiSodaColl__find(dpiSodaColl *coll,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSodaColl__flushInsertBatch() [INTERNAL]
+//   Insert the documents in the batch using a single bulk insert and then
+// release them from the batch, whether or not the insert succeeded. If a
+// callback was registered, it is called after each successful insert with the
+// number of documents inserted. The batch lock is expected to be held.
+//-----------------------------------------------------------------------------
+static int dpiSodaColl__flushInsertBatch(dpiSodaColl *coll, dpiError *error)
+{
+    uint32_t i, numDocs;
+    int status;
+
+    numDocs = coll->insertBatchNumDocs;
+    if (numDocs == 0)
+        return DPI_SUCCESS;
+    for (i = 0; i < numDocs; i++)
+        coll->insertBatchHandles[i] = coll->insertBatch[i]->handle;
+    status = dpiSodaColl__insertMany(coll, numDocs, coll->insertBatchHandles,
+            coll->insertBatchFlags, NULL, NULL, error);
+    for (i = 0; i < numDocs; i++) {
+        dpiGen__setRefCount(coll->insertBatch[i], error, -1);
+        coll->insertBatch[i] = NULL;
+        coll->insertBatchHandles[i] = NULL;
+    }
+    coll->insertBatchNumDocs = 0;
+    if (status < 0)
+        return DPI_FAILURE;
+    coll->insertBatchTotalDocs += numDocs;
+    if (coll->insertBatchCallback)
+        (*coll->insertBatchCallback)(coll->insertBatchCallbackContext,
+                numDocs, coll->insertBatchTotalDocs);
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSodaColl__free() [INTERNAL]
 //   Free the memory for a SODA collection. Note that the reference to the
@@ -183,6 +254,19 @@ static int dpiSodaColl__find(dpiSodaColl *coll,
 //-----------------------------------------------------------------------------
 void dpiSodaColl__free(dpiSodaColl *coll, dpiError *error)
 {
+    uint32_t i;
+
+    if (coll->insertBatch) {
+        for (i = 0; i < coll->insertBatchNumDocs; i++)
+            dpiGen__setRefCount(coll->insertBatch[i], error, -1);
+        dpiUtils__freeMemory(coll->insertBatch);
+        coll->insertBatch = NULL;
+    }
+    if (coll->insertBatchHandles) {
+        dpiUtils__freeMemory(coll->insertBatchHandles);
+        coll->insertBatchHandles = NULL;
+    }
+    dpiMutex__destroy(coll->insertBatchMutex);
     if (coll->handle) {
         dpiOci__handleFree(coll->handle, DPI_OCI_HTYPE_SODA_COLLECTION);
         coll->handle = NULL;
@@ -224,6 +308,33 @@ static int dpiSodaColl__getDocCount(dpiSodaColl *coll,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSodaColl__insertBatched() [INTERNAL]
+//   Add a document to the batch of documents to be inserted. The batch takes
+// ownership of the document and inserts the batch when it reaches the
+// configured size. If batching has not been configured, the document is
+// inserted immediately.
+//-----------------------------------------------------------------------------
+static int dpiSodaColl__insertBatched(dpiSodaColl *coll, dpiSodaDoc *doc,
+        dpiError *error)
+{
+    int status = DPI_SUCCESS;
+
+    dpiMutex__acquire(coll->insertBatchMutex);
+    if (!coll->insertBatch)
+        status = dpiSodaColl__allocateInsertBatch(coll, 1, error);
+    if (status == DPI_SUCCESS) {
+        coll->insertBatch[coll->insertBatchNumDocs++] = doc;
+        if (coll->insertBatchNumDocs == coll->insertBatchMaxDocs)
+            status = dpiSodaColl__flushInsertBatch(coll, error);
+    } else {
+        dpiGen__setRefCount(doc, error, -1);
+    }
+    dpiMutex__release(coll->insertBatchMutex);
+    return status;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSodaColl__insertMany() [INTERNAL]
 //   Insert multiple documents into the collection and return handles to the
@@ -706,6 +817,24 @@ int dpiSodaColl_findOne(dpiSodaColl *coll, const dpiSodaOperOptions *options,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSodaColl_flushInsert() [PUBLIC]
+//   Insert all of the documents in the batch of documents to be inserted.
+//-----------------------------------------------------------------------------
+int dpiSodaColl_flushInsert(dpiSodaColl *coll)
+{
+    dpiError error;
+    int status;
+
+    if (dpiSodaColl__check(coll, __func__, &error) < 0)
+        return dpiGen__endPublicFn(coll, DPI_FAILURE, &error);
+    dpiMutex__acquire(coll->insertBatchMutex);
+    status = dpiSodaColl__flushInsertBatch(coll, &error);
+    dpiMutex__release(coll->insertBatchMutex);
+    return dpiGen__endPublicFn(coll, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSodaColl_getDataGuide() [PUBLIC]
 //   Return the data guide document for the collection.
@@ -812,6 +941,66 @@ int dpiSodaColl_getName(dpiSodaColl *coll, const char **value,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSodaColl_insertBatched() [PUBLIC]
+//   Create a document with the supplied encoded JSON content and add it to
+// the batch of documents to be inserted.
+//-----------------------------------------------------------------------------
+int dpiSodaColl_insertBatched(dpiSodaColl *coll, const char *key,
+        uint32_t keyLength, const char *content, uint32_t contentLength)
+{
+    dpiSodaDoc *doc;
+    dpiError error;
+    int status;
+
+    // validate parameters
+    if (dpiSodaColl__check(coll, __func__, &error) < 0)
+        return dpiGen__endPublicFn(coll, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_AND_LENGTH(coll, key)
+    DPI_CHECK_PTR_AND_LENGTH(coll, content)
+
+    // bulk insert is only supported with Oracle Client 18.5+
+    if (dpiUtils__checkClientVersion(coll->env->versionInfo, 18, 5,
+            &error) < 0)
+        return dpiGen__endPublicFn(coll, DPI_FAILURE, &error);
+
+    // create document and add it to the batch
+    status = dpiSodaDb__createDocument(coll->db, key, keyLength, content,
+            contentLength, NULL, 0, &doc, &error);
+    if (status == DPI_SUCCESS)
+        status = dpiSodaColl__insertBatched(coll, doc, &error);
+    return dpiGen__endPublicFn(coll, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSodaColl_insertJsonBatched() [PUBLIC]
+//   Create a document with the supplied JSON content and add it to the batch
+// of documents to be inserted. This is only supported with Oracle Client 23ai
+// and higher.
+//-----------------------------------------------------------------------------
+int dpiSodaColl_insertJsonBatched(dpiSodaColl *coll, const char *key,
+        uint32_t keyLength, const dpiJsonNode *content)
+{
+    dpiSodaDoc *doc;
+    dpiError error;
+    int status;
+
+    // validate parameters
+    if (dpiSodaColl__check(coll, __func__, &error) < 0)
+        return dpiGen__endPublicFn(coll, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_AND_LENGTH(coll, key)
+    DPI_CHECK_PTR_NOT_NULL(coll, content)
+
+    // create document and add it to the batch
+    status = dpiSodaDb__createJsonDocument(coll->db, key, keyLength, content,
+            &doc, &error);
+    if (status == DPI_SUCCESS)
+        status = dpiSodaColl__insertBatched(coll, doc, &error);
+    return dpiGen__endPublicFn(coll, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSodaColl_insertMany() [PUBLIC]
 //   Similar to dpiSodaColl_insertManyWithOptions() but passing NULL options.
@@ -1101,6 +1290,38 @@ int dpiSodaColl_saveWithOptions(dpiSodaColl *coll, dpiSodaDoc *doc,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSodaColl_setInsertBatching() [PUBLIC]
+//   Set the number of documents at which the batch of documents added by
+// dpiSodaColl_insertBatched() and dpiSodaColl_insertJsonBatched() is inserted,
+// along with the flags used for each insert and the callback to call after
+// each insert. Any documents already in the batch are inserted first.
+//-----------------------------------------------------------------------------
+int dpiSodaColl_setInsertBatching(dpiSodaColl *coll, uint32_t maxDocs,
+        uint32_t flags, dpiSodaInsertCallback callback, void *callbackContext)
+{
+    dpiError error;
+    int status;
+
+    if (dpiSodaColl__check(coll, __func__, &error) < 0)
+        return dpiGen__endPublicFn(coll, DPI_FAILURE, &error);
+    if (maxDocs == 0)
+        maxDocs = 1;
+    dpiMutex__acquire(coll->insertBatchMutex);
+    status = dpiSodaColl__flushInsertBatch(coll, &error);
+    if (status == DPI_SUCCESS && maxDocs != coll->insertBatchMaxDocs)
+        status = dpiSodaColl__allocateInsertBatch(coll, maxDocs, &error);
+    if (status == DPI_SUCCESS) {
+        coll->insertBatchFlags = flags;
+        coll->insertBatchCallback = callback;
+        coll->insertBatchCallbackContext = callbackContext;
+        coll->insertBatchTotalDocs = 0;
+    }
+    dpiMutex__release(coll->insertBatchMutex);
+    return dpiGen__endPublicFn(coll, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSodaColl_truncate() [PUBLIC]
 //   Remove all of the documents in the collection.
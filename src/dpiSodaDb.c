@@ -48,7 +48,7 @@ static int dpiSodaDb__checkConnected(dpiSodaDb *db, const char *fnName,
 // dpiSodaDb__createDocument() [INTERNAL]
 //   Create a document and set the supplied values, if applicable.
 //-----------------------------------------------------------------------------
-static int dpiSodaDb__createDocument(dpiSodaDb *db, const char *key,
+int dpiSodaDb__createDocument(dpiSodaDb *db, const char *key,
         uint32_t keyLength, const char *content, uint32_t contentLength,
         const char *mediaType, uint32_t mediaTypeLength, dpiSodaDoc **doc,
         dpiError *error)
@@ -103,6 +103,57 @@ static int dpiSodaDb__createDocument(dpiSodaDb *db, const char *key,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSodaDb__createJsonDocument() [INTERNAL]
+//   Create a document with JSON content. This is only supported with Oracle
+// Client 23ai and higher.
+//-----------------------------------------------------------------------------
+int dpiSodaDb__createJsonDocument(dpiSodaDb *db, const char *key,
+        uint32_t keyLength, const dpiJsonNode *content, dpiSodaDoc **doc,
+        dpiError *error)
+{
+    int status, jsonDesc;
+    uint32_t tempLength;
+    dpiSodaDoc *tempDoc;
+    void *jsonHandle;
+
+    // only supported in Oracle Client 23ai+
+    if (dpiUtils__checkClientVersion(db->env->versionInfo, 23, 4, error) < 0)
+        return DPI_FAILURE;
+
+    // create document
+    if (dpiSodaDb__createDocument(db, key, keyLength, NULL, 0, NULL, 0,
+            &tempDoc, error) < 0)
+        return DPI_FAILURE;
+
+    // populate content, if applicable
+    if (content) {
+        jsonDesc = 1;
+        status = dpiOci__attrSet(tempDoc->handle, DPI_OCI_HTYPE_SODA_DOCUMENT,
+                &jsonDesc, 0, DPI_OCI_ATTR_SODA_JSON_DESC,
+                "set JSON descriptor flag", error);
+        if (status == DPI_SUCCESS) {
+            status = dpiOci__attrGet(tempDoc->handle,
+                    DPI_OCI_HTYPE_SODA_DOCUMENT, (void*) &jsonHandle,
+                    &tempLength, DPI_OCI_ATTR_SODA_CONTENT,
+                    "get JSON descriptor", error);
+        }
+        if (status == DPI_SUCCESS)
+            status = dpiJson__allocate(db->conn, jsonHandle, &tempDoc->json,
+                    error);
+        if (status == DPI_SUCCESS)
+            status = dpiJson__setValue(tempDoc->json, content, error);
+        if (status != DPI_SUCCESS) {
+            dpiSodaDoc__free(tempDoc, error);
+            return DPI_FAILURE;
+        }
+    }
+
+    *doc = tempDoc;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSodaDb__getCollectionNames() [PUBLIC]
 //   Internal method used for getting all collection names from the database.
@@ -250,11 +301,8 @@ int dpiSodaDb_createJsonDocument(dpiSodaDb *db, const char *key,
         uint32_t keyLength, const dpiJsonNode *content, UNUSED uint32_t flags,
         dpiSodaDoc **doc)
 {
-    int status, jsonDesc;
-    uint32_t tempLength;
-    dpiSodaDoc *tempDoc;
-    void *jsonHandle;
     dpiError error;
+    int status;
 
     // validate parameters
     if (dpiSodaDb__checkConnected(db, __func__, &error) < 0)
@@ -262,40 +310,10 @@ int dpiSodaDb_createJsonDocument(dpiSodaDb *db, const char *key,
     DPI_CHECK_PTR_AND_LENGTH(db, key)
     DPI_CHECK_PTR_NOT_NULL(db, doc)
 
-    // only supported in Oracle Client 23ai+
-    if (dpiUtils__checkClientVersion(db->env->versionInfo, 23, 4, &error) < 0)
-        return dpiGen__endPublicFn(db, DPI_FAILURE, &error);
-
     // create document
-    if (dpiSodaDb__createDocument(db, key, keyLength, NULL, 0, NULL, 0,
-            &tempDoc, &error) < 0)
-        return dpiGen__endPublicFn(db, DPI_FAILURE, &error);
-
-    // populate content, if applicable
-    if (content) {
-        jsonDesc = 1;
-        status = dpiOci__attrSet(tempDoc->handle, DPI_OCI_HTYPE_SODA_DOCUMENT,
-                &jsonDesc, 0, DPI_OCI_ATTR_SODA_JSON_DESC,
-                "set JSON descriptor flag", &error);
-        if (status == DPI_SUCCESS) {
-            status = dpiOci__attrGet(tempDoc->handle,
-                    DPI_OCI_HTYPE_SODA_DOCUMENT, (void*) &jsonHandle,
-                    &tempLength, DPI_OCI_ATTR_SODA_CONTENT,
-                    "get JSON descriptor", &error);
-        }
-        if (status == DPI_SUCCESS)
-            status = dpiJson__allocate(db->conn, jsonHandle, &tempDoc->json,
-                    &error);
-        if (status == DPI_SUCCESS)
-            status = dpiJson__setValue(tempDoc->json, content, &error);
-        if (status != DPI_SUCCESS) {
-            dpiSodaDoc__free(tempDoc, &error);
-            return dpiGen__endPublicFn(db, DPI_FAILURE, &error);
-        }
-    }
-
-    *doc = tempDoc;
-    return dpiGen__endPublicFn(db, DPI_SUCCESS, &error);
+    status = dpiSodaDb__createJsonDocument(db, key, keyLength, content, doc,
+            &error);
+    return dpiGen__endPublicFn(db, status, &error);
 }
 
 
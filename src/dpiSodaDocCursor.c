@@ -68,6 +68,35 @@ static int dpiSodaDocCursor__check(dpiSodaDocCursor *cursor,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSodaDocCursor__fetch() [INTERNAL]
+//   Fetch up to the specified number of documents from the cursor. The
+// number of documents fetched is always returned, even if an error occurs, so
+// that the documents already fetched can be released by the caller.
+//-----------------------------------------------------------------------------
+static int dpiSodaDocCursor__fetch(dpiSodaDocCursor *cursor, uint32_t maxDocs,
+        dpiSodaDoc **docs, uint32_t *numDocs, dpiError *error)
+{
+    void *handle;
+
+    *numDocs = 0;
+    while (*numDocs < maxDocs) {
+        if (dpiOci__sodaDocGetNext(cursor, &handle, error) < 0)
+            return DPI_FAILURE;
+        if (!handle)
+            break;
+        if (dpiSodaDoc__allocate(cursor->coll->db, handle, &docs[*numDocs],
+                error) < 0) {
+            dpiOci__handleFree(handle, DPI_OCI_HTYPE_SODA_DOCUMENT);
+            return DPI_FAILURE;
+        }
+        docs[*numDocs]->binaryContent = cursor->coll->binaryContent;
+        (*numDocs)++;
+    }
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSodaDocCursor__free() [INTERNAL]
 //   Free the memory for a SODA document cursor. Note that the reference to the
@@ -123,26 +152,43 @@ int dpiSodaDocCursor_close(dpiSodaDocCursor *cursor)
 int dpiSodaDocCursor_getNext(dpiSodaDocCursor *cursor, UNUSED uint32_t flags,
         dpiSodaDoc **doc)
 {
+    uint32_t numDocs;
     dpiError error;
-    void *handle;
 
     if (dpiSodaDocCursor__check(cursor, __func__, &error) < 0)
         return dpiGen__endPublicFn(cursor, DPI_FAILURE, &error);
     DPI_CHECK_PTR_NOT_NULL(cursor, doc)
-    if (dpiOci__sodaDocGetNext(cursor, &handle, &error) < 0)
-        return dpiGen__endPublicFn(cursor, DPI_FAILURE, &error);
     *doc = NULL;
-    if (handle) {
-        if (dpiSodaDoc__allocate(cursor->coll->db, handle, doc, &error) < 0) {
-            dpiOci__handleFree(handle, DPI_OCI_HTYPE_SODA_DOCUMENT);
-            return dpiGen__endPublicFn(cursor, DPI_FAILURE, &error);
-        }
-        (*doc)->binaryContent = cursor->coll->binaryContent;
-    }
+    if (dpiSodaDocCursor__fetch(cursor, 1, doc, &numDocs, &error) < 0)
+        return dpiGen__endPublicFn(cursor, DPI_FAILURE, &error);
     return dpiGen__endPublicFn(cursor, DPI_SUCCESS, &error);
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSodaDocCursor_getNextMany() [PUBLIC]
+//   Return up to the specified number of documents from the cursor. Round
+// trips to the database are governed by the fetch array size specified when
+// the cursor was created.
+//-----------------------------------------------------------------------------
+int dpiSodaDocCursor_getNextMany(dpiSodaDocCursor *cursor,
+        UNUSED uint32_t flags, uint32_t maxDocs, dpiSodaDoc **docs,
+        uint32_t *numDocs)
+{
+    dpiError error;
+    int status;
+
+    if (dpiSodaDocCursor__check(cursor, __func__, &error) < 0)
+        return dpiGen__endPublicFn(cursor, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(cursor, docs)
+    DPI_CHECK_PTR_NOT_NULL(cursor, numDocs)
+    status = dpiSodaDocCursor__fetch(cursor, maxDocs, docs, numDocs, &error);
+    if (status < 0)
+        error.buffer->offset = *numDocs;
+    return dpiGen__endPublicFn(cursor, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSodaDocCursor_release() [PUBLIC]
 //   Release a reference to the SODA document cursor.
@@ -30,6 +30,7 @@
 #include "dpiImpl.h"
 
 // forward declarations of internal functions only used in this file
+static int dpiStmt__getBatchErrors(dpiStmt *stmt, dpiError *error);
 static int dpiStmt__getQueryInfo(dpiStmt *stmt, uint32_t pos,
         dpiQueryInfo *info, dpiError *error);
 static int dpiStmt__getQueryInfoFromParam(dpiStmt *stmt, void *param,
@@ -495,7 +496,8 @@ static int dpiStmt__define(dpiStmt *stmt, uint32_t pos, dpiVar *var,
 {
     void *defineHandle = NULL;
     dpiQueryInfo *queryInfo;
-    int tempBool;
+    int tempBool, lobAsBytes;
+    uint32_t prefetchSize;
 
     // no need to perform define if variable is unchanged
     if (stmt->queryVars[pos - 1] == var)
@@ -526,7 +528,12 @@ static int dpiStmt__define(dpiStmt *stmt, uint32_t pos, dpiVar *var,
     }
 
     // specify that the LOB length should be prefetched
-    if (var->nativeTypeNum == DPI_NATIVE_TYPE_LOB) {
+    lobAsBytes = (var->nativeTypeNum == DPI_NATIVE_TYPE_BYTES &&
+            (var->type->oracleTypeNum == DPI_ORACLE_TYPE_CLOB ||
+            var->type->oracleTypeNum == DPI_ORACLE_TYPE_NCLOB ||
+            var->type->oracleTypeNum == DPI_ORACLE_TYPE_BLOB ||
+            var->type->oracleTypeNum == DPI_ORACLE_TYPE_BFILE));
+    if (var->nativeTypeNum == DPI_NATIVE_TYPE_LOB || lobAsBytes) {
         tempBool = 1;
         if (dpiOci__attrSet(defineHandle, DPI_OCI_HTYPE_DEFINE,
                 (void*) &tempBool, 0, DPI_OCI_ATTR_LOBPREFETCH_LENGTH,
@@ -534,6 +541,17 @@ static int dpiStmt__define(dpiStmt *stmt, uint32_t pos, dpiVar *var,
             return DPI_FAILURE;
     }
 
+    // for LOBs fetched as bytes, the LOB data is always read so prefetch it as
+    // well; values that fit are returned with the fetch and do not require
+    // additional round trips to determine the length and read the data
+    if (lobAsBytes && var->type->oracleTypeNum != DPI_ORACLE_TYPE_BFILE) {
+        prefetchSize = DPI_LOB_PREFETCH_SIZE;
+        if (dpiOci__attrSet(defineHandle, DPI_OCI_HTYPE_DEFINE,
+                (void*) &prefetchSize, 0, DPI_OCI_ATTR_LOBPREFETCH_SIZE,
+                "set lob prefetch size", error) < 0)
+            return DPI_FAILURE;
+    }
+
     // define objects, if applicable
     if (var->buffer.objectIndicator && dpiOci__defineObject(var, defineHandle,
             error) < 0)
@@ -560,26 +578,33 @@ static int dpiStmt__define(dpiStmt *stmt, uint32_t pos, dpiVar *var,
 static int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
         uint32_t mode, int reExecute, dpiError *error)
 {
-    uint32_t i, j, temp, sqlIdLength;
+    uint32_t i, j, temp, sqlIdLength, numElements;
     uint16_t tempOffset;
-    dpiData *data;
     dpiVar *var;
     char *sqlId;
 
     // for all bound variables, transfer data from dpiData structure to Oracle
-    // buffer structures
+    // buffer structures; if a non-blocking execution is already in progress
+    // this transfer has already taken place and is not repeated; only the
+    // elements used by the iterations being executed are transferred (the
+    // elements in use for arrays) and values that are unchanged since they
+    // were last transferred are skipped where possible
     for (i = 0; i < stmt->numBindVars; i++) {
         var = stmt->bindVars[i].var;
         if (var->isArray && numIters > 1)
             return dpiError__set(error, "bind array var",
                     DPI_ERR_ARRAY_VAR_NOT_SUPPORTED);
-        for (j = 0; j < var->buffer.maxArraySize; j++) {
-            data = &var->buffer.externalData[j];
-            if (dpiVar__setValue(var, &var->buffer, j, data, error) < 0)
+        numElements = (var->isArray) ? var->buffer.actualArraySize :
+                var->buffer.maxArraySize;
+        if (!var->isArray && numIters < numElements)
+            numElements = (numIters == 0) ? 1 : numIters;
+        for (j = 0; !stmt->executePending && j < numElements; j++) {
+            if (dpiVar__setValueIfChanged(var, j, error) < 0)
                 return DPI_FAILURE;
-            if (var->dynBindBuffers)
-                var->dynBindBuffers[j].actualArraySize = 0;
         }
+        for (j = 0; !stmt->executePending && var->dynBindBuffers &&
+                j < var->buffer.maxArraySize; j++)
+            var->dynBindBuffers[j].actualArraySize = 0;
         if (stmt->isReturning || var->isDynamic)
             var->error = error;
     }
@@ -605,18 +630,24 @@ static int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
 
     // if requested, suspend the sessionless transaction after the call
     // completes successfully
-    if (mode & DPI_MODE_EXEC_SUSPEND_ON_SUCCESS) {
+    if (mode & DPI_MODE_EXEC_SUSPEND_ON_SUCCESS && !stmt->executePending) {
         if (dpiConn__suspendSessionlessTransaction(stmt->conn,
                 DPI_OCI_SUSPEND_POST_CALL, error) < 0)
             return DPI_FAILURE;
     }
 
-    // perform execution
+    // perform execution; if the connection is in non-blocking mode and the
+    // call has not yet completed, the execution is marked as pending so that
+    // the next call simply continues it
     // re-execute statement for ORA-01007: variable not in select list and
     // ORA-00932: inconsistent data types; drop statement from cache for all
     // errors (except those which are due to invalid data which may be fixed in
     // subsequent execution)
     if (dpiOci__stmtExecute(stmt, numIters, mode, error) < 0) {
+        stmt->executePending =
+                (error->buffer->errorNum == DPI_ERR_STILL_EXECUTING);
+        if (stmt->executePending)
+            return DPI_FAILURE;
         dpiOci__attrGet(stmt->handle, DPI_OCI_HTYPE_STMT, &tempOffset, 0,
                 DPI_OCI_ATTR_PARSE_ERROR_OFFSET, "set parse offset", error);
         error->buffer->offset = tempOffset;
@@ -641,6 +672,7 @@ static int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
         }
         return DPI_FAILURE;
     }
+    stmt->executePending = 0;
 
     // if requested, the sessionless transaction would have been suspended so
     // clear the transaction now
@@ -673,13 +705,16 @@ static int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
 
     // for all bound variables, transfer data from Oracle buffer structures to
     // dpiData structures; OCI doesn't provide a way of knowing if a variable
-    // is an out variable so do this for all of them when this is a possibility
+    // is an out variable so do this for all of them when this is a
+    // possibility; for PL/SQL arrays only the elements in use are transferred
     if (stmt->isReturning || stmt->statementType == DPI_STMT_TYPE_BEGIN ||
             stmt->statementType == DPI_STMT_TYPE_DECLARE ||
             stmt->statementType == DPI_STMT_TYPE_CALL) {
         for (i = 0; i < stmt->numBindVars; i++) {
             var = stmt->bindVars[i].var;
-            for (j = 0; j < var->buffer.maxArraySize; j++) {
+            numElements = (var->isArray) ? var->buffer.actualArraySize :
+                    var->buffer.maxArraySize;
+            for (j = 0; j < numElements; j++) {
                 if (dpiVar__getValue(var, &var->buffer, j, 0, error) < 0)
                     return DPI_FAILURE;
             }
@@ -699,20 +734,168 @@ static int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt__executeMany() [INTERNAL]
+//   Execute a statement multiple times. Queries are not supported. The bind
+// variables are checked to ensure that their maxArraySize is sufficient to
+// support this.
+//-----------------------------------------------------------------------------
+static int dpiStmt__executeMany(dpiStmt *stmt, uint32_t mode,
+        uint32_t numIters, dpiError *error)
+{
+    uint32_t i;
+
+    // queries are not supported
+    if (stmt->statementType == DPI_STMT_TYPE_SELECT)
+        return dpiError__set(error, "check statement type",
+                DPI_ERR_NOT_SUPPORTED);
+
+    // batch errors and array DML row counts are only supported with DML
+    // statements (insert, update, delete and merge)
+    if ((mode & DPI_MODE_EXEC_BATCH_ERRORS ||
+                mode & DPI_MODE_EXEC_ARRAY_DML_ROWCOUNTS) &&
+            stmt->statementType != DPI_STMT_TYPE_INSERT &&
+            stmt->statementType != DPI_STMT_TYPE_UPDATE &&
+            stmt->statementType != DPI_STMT_TYPE_DELETE &&
+            stmt->statementType != DPI_STMT_TYPE_MERGE)
+        return dpiError__set(error, "check mode",
+                DPI_ERR_EXEC_MODE_ONLY_FOR_DML);
+
+    // ensure that all bind variables have a big enough maxArraySize to
+    // support this operation
+    for (i = 0; i < stmt->numBindVars; i++) {
+        if (stmt->bindVars[i].var->buffer.maxArraySize < numIters)
+            return dpiError__set(error, "check array size",
+                    DPI_ERR_ARRAY_SIZE_TOO_SMALL,
+                    stmt->bindVars[i].var->buffer.maxArraySize);
+    }
+
+    // perform execution
+    dpiStmt__clearBatchErrors(stmt);
+    if (dpiStmt__execute(stmt, numIters, mode, 0, error) < 0)
+        return DPI_FAILURE;
+
+    // handle batch errors if mode was specified
+    if (mode & DPI_MODE_EXEC_BATCH_ERRORS) {
+        if (dpiStmt__getBatchErrors(stmt, error) < 0)
+            return DPI_FAILURE;
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__executeManyFromArrow() [INTERNAL]
+//   Execute a statement multiple times using the rows of an Arrow struct array
+// as the bind values. A variable is created for each column of the struct
+// array and bound to the position matching the column (the first column is
+// bound to position 1). The statement is then executed for each batch of
+// rows. If batch errors are enabled and any errors are found, processing
+// stops after the batch in which they were found and the offsets of the batch
+// errors are adjusted to refer to the rows of the struct array. A commit on
+// success is only requested for the last batch.
+//-----------------------------------------------------------------------------
+static int dpiStmt__executeManyFromArrow(dpiStmt *stmt, uint32_t mode,
+        const struct ArrowSchema *schema, const struct ArrowArray *array,
+        uint32_t batchSize, dpiError *error)
+{
+    uint32_t i, numColumns, numRows, batchMode;
+    dpiVar **vars = NULL;
+    int64_t startRow;
+    int status;
+
+    // validate the struct array and determine the size of each batch
+    if (!schema->format || strcmp(schema->format, "+s") != 0)
+        return dpiError__set(error, "check format",
+                DPI_ERR_ARROW_FORMAT_NOT_SUPPORTED,
+                schema->format ? schema->format : "", 0);
+    if (!array->release || array->length < 0 || array->offset < 0 ||
+            array->n_children != schema->n_children ||
+            array->n_buffers != 1)
+        return dpiError__set(error, "check array",
+                DPI_ERR_INVALID_ARROW_ARRAY, 0);
+    if (array->length == 0 || schema->n_children == 0)
+        return DPI_SUCCESS;
+    if (batchSize == 0 || batchSize > array->length)
+        batchSize = (array->length > UINT_MAX) ? UINT_MAX :
+                (uint32_t) array->length;
+    numColumns = (uint32_t) schema->n_children;
+
+    // create and bind a variable for each column
+    if (dpiUtils__allocateMemory(numColumns, sizeof(dpiVar*), 1,
+            "allocate Arrow variables", (void**) &vars, error) < 0)
+        return DPI_FAILURE;
+    status = DPI_SUCCESS;
+    for (i = 0; i < numColumns && status == DPI_SUCCESS; i++) {
+        status = dpiArrow__newVar(stmt->conn, schema, array, i, batchSize,
+                &vars[i], error);
+        if (status == DPI_SUCCESS)
+            status = dpiStmt__bind(stmt, vars[i], i + 1, NULL, 0, error);
+    }
+
+    // transfer the values and execute the statement for each batch; a commit
+    // (if requested) is only performed by the last batch so that the rows are
+    // committed together once all of them have been processed
+    for (startRow = 0; startRow < array->length && status == DPI_SUCCESS;
+            startRow += numRows) {
+        numRows = batchSize;
+        if (array->length - startRow < numRows)
+            numRows = (uint32_t) (array->length - startRow);
+        for (i = 0; i < numColumns && status == DPI_SUCCESS; i++)
+            status = dpiArrow__setVar(vars[i], schema, array, i, startRow,
+                    numRows, error);
+        batchMode = mode;
+        if (startRow + numRows < array->length)
+            batchMode &= ~DPI_MODE_EXEC_COMMIT_ON_SUCCESS;
+        if (status == DPI_SUCCESS)
+            status = dpiStmt__executeMany(stmt, batchMode, numRows, error);
+        if (status == DPI_SUCCESS && stmt->numBatchErrors > 0) {
+            for (i = 0; i < stmt->numBatchErrors; i++)
+                stmt->batchErrors[i].offset += (uint32_t) startRow;
+            break;
+        }
+    }
+
+    // release the references to the variables; the statement retains its own
+    // references to the variables that were bound
+    for (i = 0; i < numColumns; i++) {
+        if (vars[i])
+            dpiGen__setRefCount(vars[i], error, -1);
+    }
+    dpiUtils__freeMemory(vars);
+    return status;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt__fetch() [INTERNAL]
 //   Performs the actual fetch from Oracle.
 //-----------------------------------------------------------------------------
 static int dpiStmt__fetch(dpiStmt *stmt, dpiError *error)
 {
-    // perform any pre-fetch activities required
-    if (dpiStmt__beforeFetch(stmt, error) < 0)
+    uint32_t i;
+
+    // perform any pre-fetch activities required; if a non-blocking fetch is
+    // already in progress these have already been performed and only the
+    // error structure referenced by the query variables needs to be updated
+    if (stmt->fetchPending) {
+        for (i = 0; i < stmt->numQueryVars; i++)
+            stmt->queryVars[i]->error = error;
+    } else if (dpiStmt__beforeFetch(stmt, error) < 0) {
         return DPI_FAILURE;
+    }
 
-    // perform fetch
+    // perform fetch; if the connection is in non-blocking mode and the call
+    // has not yet completed, the fetch is marked as pending so that the next
+    // call simply continues it
     if (dpiOci__stmtFetch2(stmt, stmt->fetchArraySize, DPI_MODE_FETCH_NEXT, 0,
-            error) < 0)
+            error) < 0) {
+        stmt->fetchPending =
+                (error->buffer->errorNum == DPI_ERR_STILL_EXECUTING);
         return DPI_FAILURE;
+    }
+    stmt->fetchPending = 0;
 
     // determine the number of rows fetched into buffers
     if (dpiOci__attrGet(stmt->handle, DPI_OCI_HTYPE_STMT,
@@ -732,6 +915,39 @@ static int dpiStmt__fetch(dpiStmt *stmt, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt__fetchRows() [INTERNAL]
+//   Fetch rows into buffers and return the number of rows that were so
+// fetched. If there are still rows available in the buffer, no additional
+// fetch will take place.
+//-----------------------------------------------------------------------------
+static int dpiStmt__fetchRows(dpiStmt *stmt, uint32_t maxRows,
+        uint32_t *bufferRowIndex, uint32_t *numRowsFetched, int *moreRows,
+        dpiError *error)
+{
+    if (stmt->bufferRowIndex >= stmt->bufferRowCount) {
+        if (stmt->hasRowsToFetch && dpiStmt__fetch(stmt, error) < 0)
+            return DPI_FAILURE;
+        if (stmt->bufferRowIndex >= stmt->bufferRowCount) {
+            *moreRows = 0;
+            *bufferRowIndex = 0;
+            *numRowsFetched = 0;
+            return DPI_SUCCESS;
+        }
+    }
+    *bufferRowIndex = stmt->bufferRowIndex;
+    *numRowsFetched = stmt->bufferRowCount - stmt->bufferRowIndex;
+    *moreRows = stmt->hasRowsToFetch;
+    if (*numRowsFetched > maxRows) {
+        *numRowsFetched = maxRows;
+        *moreRows = 1;
+    }
+    stmt->bufferRowIndex += *numRowsFetched;
+    stmt->rowCount += *numRowsFetched;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt__free() [INTERNAL]
 //   Free the memory associated with the statement.
@@ -1296,60 +1512,39 @@ int dpiStmt_execute(dpiStmt *stmt, dpiExecMode mode, uint32_t *numQueryColumns)
 
 //-----------------------------------------------------------------------------
 // dpiStmt_executeMany() [PUBLIC]
-//   Execute a statement multiple times. Queries are not supported. The bind
-// variables are checked to ensure that their maxArraySize is sufficient to
-// support this.
+//   Execute a statement multiple times.
 //-----------------------------------------------------------------------------
 int dpiStmt_executeMany(dpiStmt *stmt, dpiExecMode mode, uint32_t numIters)
 {
     dpiError error;
-    uint32_t i;
+    int status;
 
-    // verify statement is open
     if (dpiStmt__check(stmt, __func__, &error) < 0)
         return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    status = dpiStmt__executeMany(stmt, mode, numIters, &error);
+    return dpiGen__endPublicFn(stmt, status, &error);
+}
 
-    // queries are not supported
-    if (stmt->statementType == DPI_STMT_TYPE_SELECT) {
-        dpiError__set(&error, "check statement type", DPI_ERR_NOT_SUPPORTED);
-        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
-    }
-
-    // batch errors and array DML row counts are only supported with DML
-    // statements (insert, update, delete and merge)
-    if ((mode & DPI_MODE_EXEC_BATCH_ERRORS ||
-                mode & DPI_MODE_EXEC_ARRAY_DML_ROWCOUNTS) &&
-            stmt->statementType != DPI_STMT_TYPE_INSERT &&
-            stmt->statementType != DPI_STMT_TYPE_UPDATE &&
-            stmt->statementType != DPI_STMT_TYPE_DELETE &&
-            stmt->statementType != DPI_STMT_TYPE_MERGE) {
-        dpiError__set(&error, "check mode", DPI_ERR_EXEC_MODE_ONLY_FOR_DML);
-        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
-    }
 
-    // ensure that all bind variables have a big enough maxArraySize to
-    // support this operation
-    for (i = 0; i < stmt->numBindVars; i++) {
-        if (stmt->bindVars[i].var->buffer.maxArraySize < numIters) {
-            dpiError__set(&error, "check array size",
-                    DPI_ERR_ARRAY_SIZE_TOO_SMALL,
-                    stmt->bindVars[i].var->buffer.maxArraySize);
-            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
-        }
-    }
+//-----------------------------------------------------------------------------
+// dpiStmt_executeManyFromArrow() [PUBLIC]
+//   Execute a statement multiple times using the rows of an Arrow struct array
+// as the bind values.
+//-----------------------------------------------------------------------------
+int dpiStmt_executeManyFromArrow(dpiStmt *stmt, dpiExecMode mode,
+        const struct ArrowSchema *schema, const struct ArrowArray *array,
+        uint32_t batchSize)
+{
+    dpiError error;
+    int status;
 
-    // perform execution
-    dpiStmt__clearBatchErrors(stmt);
-    if (dpiStmt__execute(stmt, numIters, mode, 0, &error) < 0)
+    if (dpiStmt__check(stmt, __func__, &error) < 0)
         return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
-
-    // handle batch errors if mode was specified
-    if (mode & DPI_MODE_EXEC_BATCH_ERRORS) {
-        if (dpiStmt__getBatchErrors(stmt, &error) < 0)
-            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
-    }
-
-    return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
+    DPI_CHECK_PTR_NOT_NULL(stmt, schema)
+    DPI_CHECK_PTR_NOT_NULL(stmt, array)
+    status = dpiStmt__executeManyFromArrow(stmt, mode, schema, array,
+            batchSize, &error);
+    return dpiGen__endPublicFn(stmt, status, &error);
 }
 
 
@@ -1384,39 +1579,22 @@ int dpiStmt_fetch(dpiStmt *stmt, int *found, uint32_t *bufferRowIndex)
 //-----------------------------------------------------------------------------
 // dpiStmt_fetchRows() [PUBLIC]
 //   Fetch rows into buffers and return the number of rows that were so
-// fetched. If there are still rows available in the buffer, no additional
-// fetch will take place.
+// fetched.
 //-----------------------------------------------------------------------------
 int dpiStmt_fetchRows(dpiStmt *stmt, uint32_t maxRows,
         uint32_t *bufferRowIndex, uint32_t *numRowsFetched, int *moreRows)
 {
     dpiError error;
+    int status;
 
     if (dpiStmt__check(stmt, __func__, &error) < 0)
         return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
     DPI_CHECK_PTR_NOT_NULL(stmt, bufferRowIndex)
     DPI_CHECK_PTR_NOT_NULL(stmt, numRowsFetched)
     DPI_CHECK_PTR_NOT_NULL(stmt, moreRows)
-    if (stmt->bufferRowIndex >= stmt->bufferRowCount) {
-        if (stmt->hasRowsToFetch && dpiStmt__fetch(stmt, &error) < 0)
-            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
-        if (stmt->bufferRowIndex >= stmt->bufferRowCount) {
-            *moreRows = 0;
-            *bufferRowIndex = 0;
-            *numRowsFetched = 0;
-            return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
-        }
-    }
-    *bufferRowIndex = stmt->bufferRowIndex;
-    *numRowsFetched = stmt->bufferRowCount - stmt->bufferRowIndex;
-    *moreRows = stmt->hasRowsToFetch;
-    if (*numRowsFetched > maxRows) {
-        *numRowsFetched = maxRows;
-        *moreRows = 1;
-    }
-    stmt->bufferRowIndex += *numRowsFetched;
-    stmt->rowCount += *numRowsFetched;
-    return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
+    status = dpiStmt__fetchRows(stmt, maxRows, bufferRowIndex, numRowsFetched,
+            moreRows, &error);
+    return dpiGen__endPublicFn(stmt, status, &error);
 }
 
 
@@ -30,7 +30,16 @@
 #include "dpiImpl.h"
 
 // forward declarations of internal functions only used in this file
+static int dpiSubscr__copyMessage(dpiSubscrMessage *message,
+        dpiSubscrMessage **copy, dpiError *error);
+static dpiSubscrMessageTable *dpiSubscr__copyTables(
+        const dpiSubscrMessageTable *tables, uint32_t numTables,
+        char **structs, char **bytes);
+static void dpiSubscr__enqueueMessage(dpiSubscr *subscr,
+        dpiSubscrMessage *message, dpiError *error);
 static void dpiSubscr__freeMessage(dpiSubscrMessage *message);
+static size_t dpiSubscr__getTablesSize(const dpiSubscrMessageTable *tables,
+        uint32_t numTables, size_t *bytesSize);
 static int dpiSubscr__populateMessage(dpiSubscr *subscr,
         dpiSubscrMessage *message, void *descriptor, dpiError *error);
 static int dpiSubscr__populateMessageTable(dpiSubscr *subscr,
@@ -75,12 +84,25 @@ static void dpiSubscr__callback(dpiSubscr *subscr, UNUSED void *handle,
     }
     message.registered = subscr->registered;
 
-    // invoke user callback; temporarily increase reference count to ensure
-    // that the subscription is not freed during the callback
+    // temporarily increase reference count to ensure that the subscription is
+    // not freed during the callback
     dpiGen__setRefCount(subscr, &error, 1);
-    (*subscr->callback)(subscr->callbackContext, &message);
-    dpiSubscr__freeMessage(&message);
-    dpiMutex__release(subscr->mutex);
+
+    // when messages are queued, a copy of the message is placed on the queue
+    // and the user callback (if one was specified) is invoked without a
+    // message and without holding the lock so that the application can dequeue
+    // messages on its own threads; otherwise, invoke the user callback
+    if (subscr->maxQueuedMessages > 0) {
+        dpiSubscr__enqueueMessage(subscr, &message, &error);
+        dpiSubscr__freeMessage(&message);
+        dpiMutex__release(subscr->mutex);
+        if (subscr->callback)
+            (*subscr->callback)(subscr->callbackContext, NULL);
+    } else {
+        (*subscr->callback)(subscr->callbackContext, &message);
+        dpiSubscr__freeMessage(&message);
+        dpiMutex__release(subscr->mutex);
+    }
     dpiGen__setRefCount(subscr, &error, -1);
     dpiGen__endPublicFn(subscr, DPI_SUCCESS, &error);
 }
@@ -101,6 +123,263 @@ static int dpiSubscr__check(dpiSubscr *subscr, const char *fnName,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSubscr__coalesceMessage() [INTERNAL]
+//   Merge an object change message into the newest message on the queue, if
+// that message was queued within the coalescing window and refers to the same
+// database. Tables that appear in both messages are combined and collapsed to
+// "all rows" if the row threshold is exceeded; other tables are appended. The
+// subscription lock is expected to be held. Returns DPI_SUCCESS if the message
+// was merged.
+//-----------------------------------------------------------------------------
+static int dpiSubscr__coalesceMessage(dpiSubscr *subscr,
+        dpiSubscrMessage *message, dpiError *error)
+{
+    dpiSubscrMessageTable *tables, *target, *source;
+    dpiSubscrMessage *queuedMessage, tempMessage;
+    dpiSubscrMessageRow **allocatedRows, *rows;
+    uint32_t i, j, numTables, maxNumTables, index;
+    uint64_t now;
+    int status;
+
+    // determine if the message is eligible for merging
+    if (subscr->coalesceWindow == 0 || subscr->numQueuedMessages == 0 ||
+            message->eventType != DPI_EVENT_OBJCHANGE || message->errorInfo)
+        return DPI_FAILURE;
+    index = (subscr->queueStart + subscr->numQueuedMessages - 1) %
+            subscr->maxQueuedMessages;
+    queuedMessage = subscr->queue[index];
+    if (queuedMessage->eventType != DPI_EVENT_OBJCHANGE ||
+            queuedMessage->errorInfo ||
+            queuedMessage->dbNameLength != message->dbNameLength ||
+            (message->dbNameLength > 0 && memcmp(queuedMessage->dbName,
+                    message->dbName, message->dbNameLength) != 0))
+        return DPI_FAILURE;
+    now = dpiUtils__getMilliseconds();
+    if (now < subscr->lastQueuedTime ||
+            now - subscr->lastQueuedTime > subscr->coalesceWindow)
+        return DPI_FAILURE;
+
+    // allocate memory for the merged table entries; the rows of merged tables
+    // are tracked separately so that they can be freed afterwards
+    maxNumTables = queuedMessage->numTables + message->numTables;
+    if (dpiUtils__allocateMemory(maxNumTables, sizeof(dpiSubscrMessageTable),
+            1, "allocate merged tables", (void**) &tables, error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(maxNumTables, sizeof(dpiSubscrMessageRow*), 1,
+            "allocate merged rows", (void**) &allocatedRows, error) < 0) {
+        dpiUtils__freeMemory(tables);
+        return DPI_FAILURE;
+    }
+
+    // merge the tables of the new message with the tables already queued
+    status = DPI_SUCCESS;
+    numTables = queuedMessage->numTables;
+    for (i = 0; i < numTables; i++)
+        tables[i] = queuedMessage->tables[i];
+    for (i = 0; i < message->numTables && status == DPI_SUCCESS; i++) {
+        source = &message->tables[i];
+        target = NULL;
+        for (j = 0; j < numTables; j++) {
+            if (tables[j].nameLength == source->nameLength &&
+                    memcmp(tables[j].name, source->name,
+                            source->nameLength) == 0) {
+                target = &tables[j];
+                break;
+            }
+        }
+        if (!target) {
+            tables[numTables++] = *source;
+            continue;
+        }
+        target->operation |= source->operation;
+        if ((target->operation & DPI_OPCODE_ALL_ROWS) ||
+                (subscr->coalesceRowThreshold > 0 &&
+                target->numRows + source->numRows >
+                        subscr->coalesceRowThreshold)) {
+            target->operation |= DPI_OPCODE_ALL_ROWS;
+            target->rows = NULL;
+            target->numRows = 0;
+        } else if (source->numRows > 0) {
+            status = dpiUtils__allocateMemory(
+                    target->numRows + source->numRows,
+                    sizeof(dpiSubscrMessageRow), 0, "allocate merged rows",
+                    (void**) &rows, error);
+            if (status < 0)
+                break;
+            if (target->numRows > 0)
+                memcpy(rows, target->rows,
+                        target->numRows * sizeof(dpiSubscrMessageRow));
+            memcpy(rows + target->numRows, source->rows,
+                    source->numRows * sizeof(dpiSubscrMessageRow));
+            if (allocatedRows[j])
+                dpiUtils__freeMemory(allocatedRows[j]);
+            allocatedRows[j] = rows;
+            target->rows = rows;
+            target->numRows += source->numRows;
+        }
+    }
+
+    // replace the queued message with a copy of the merged message
+    if (status == DPI_SUCCESS) {
+        tempMessage = *queuedMessage;
+        tempMessage.tables = tables;
+        tempMessage.numTables = numTables;
+        tempMessage.registered = message->registered;
+        status = dpiSubscr__copyMessage(&tempMessage, &subscr->queue[index],
+                error);
+        if (status == DPI_SUCCESS)
+            dpiUtils__freeMemory(queuedMessage);
+    }
+    for (i = 0; i < maxNumTables; i++) {
+        if (allocatedRows[i])
+            dpiUtils__freeMemory(allocatedRows[i]);
+    }
+    dpiUtils__freeMemory(allocatedRows);
+    dpiUtils__freeMemory(tables);
+    return status;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSubscr__copyBytes() [INTERNAL]
+//   Copy the bytes of a message attribute to the buffer used for a queued
+// message and advance the buffer past them.
+//-----------------------------------------------------------------------------
+static void *dpiSubscr__copyBytes(const void *value, size_t valueLength,
+        char **bytes)
+{
+    void *copy;
+
+    if (!value)
+        return NULL;
+    copy = *bytes;
+    memcpy(copy, value, valueLength);
+    *bytes += valueLength;
+    return copy;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSubscr__copyMessage() [INTERNAL]
+//   Create a copy of the message that is independent of the OCI descriptor
+// from which it was populated so that it can be placed on the queue. The
+// structures and the data they reference are placed in a single allocation
+// so that the copy can be freed in one call.
+//-----------------------------------------------------------------------------
+static int dpiSubscr__copyMessage(dpiSubscrMessage *message,
+        dpiSubscrMessage **copy, dpiError *error)
+{
+    size_t structsSize, bytesSize, encodingLength = 0;
+    dpiSubscrMessage *tempCopy;
+    char *structs, *bytes;
+    uint32_t i;
+
+    // determine the size of the structures and the data they reference
+    structsSize = sizeof(dpiSubscrMessage);
+    bytesSize = (size_t) message->dbNameLength + message->txIdLength +
+            message->queueNameLength + message->consumerNameLength +
+            message->aqMsgIdLength;
+    structsSize += dpiSubscr__getTablesSize(message->tables,
+            message->numTables, &bytesSize);
+    structsSize += message->numQueries * sizeof(dpiSubscrMessageQuery);
+    for (i = 0; i < message->numQueries; i++)
+        structsSize += dpiSubscr__getTablesSize(message->queries[i].tables,
+                message->queries[i].numTables, &bytesSize);
+    if (message->errorInfo) {
+        structsSize += sizeof(dpiErrorInfo);
+        if (message->errorInfo->encoding)
+            encodingLength = strlen(message->errorInfo->encoding) + 1;
+        bytesSize += message->errorInfo->messageLength + encodingLength;
+    }
+
+    // allocate memory for the copy
+    if (dpiUtils__allocateMemory(1, structsSize + bytesSize, 0,
+            "allocate queued message", (void**) &structs, error) < 0)
+        return DPI_FAILURE;
+    bytes = structs + structsSize;
+
+    // populate the copy
+    tempCopy = (dpiSubscrMessage*) structs;
+    structs += sizeof(dpiSubscrMessage);
+    *tempCopy = *message;
+    tempCopy->dbName = dpiSubscr__copyBytes(message->dbName,
+            message->dbNameLength, &bytes);
+    tempCopy->txId = dpiSubscr__copyBytes(message->txId, message->txIdLength,
+            &bytes);
+    tempCopy->queueName = dpiSubscr__copyBytes(message->queueName,
+            message->queueNameLength, &bytes);
+    tempCopy->consumerName = dpiSubscr__copyBytes(message->consumerName,
+            message->consumerNameLength, &bytes);
+    tempCopy->aqMsgId = dpiSubscr__copyBytes(message->aqMsgId,
+            message->aqMsgIdLength, &bytes);
+    tempCopy->tables = dpiSubscr__copyTables(message->tables,
+            message->numTables, &structs, &bytes);
+    tempCopy->queries = NULL;
+    if (message->numQueries > 0) {
+        tempCopy->queries = (dpiSubscrMessageQuery*) structs;
+        structs += message->numQueries * sizeof(dpiSubscrMessageQuery);
+        for (i = 0; i < message->numQueries; i++) {
+            tempCopy->queries[i] = message->queries[i];
+            tempCopy->queries[i].tables =
+                    dpiSubscr__copyTables(message->queries[i].tables,
+                    message->queries[i].numTables, &structs, &bytes);
+        }
+    }
+    if (message->errorInfo) {
+        tempCopy->errorInfo = (dpiErrorInfo*) structs;
+        *tempCopy->errorInfo = *message->errorInfo;
+        tempCopy->errorInfo->message =
+                dpiSubscr__copyBytes(message->errorInfo->message,
+                message->errorInfo->messageLength, &bytes);
+        tempCopy->errorInfo->encoding =
+                dpiSubscr__copyBytes(message->errorInfo->encoding,
+                encodingLength, &bytes);
+    }
+
+    *copy = tempCopy;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSubscr__copyTables() [INTERNAL]
+//   Copy the array of message tables (and the rows they contain) to the
+// buffer used for a queued message.
+//-----------------------------------------------------------------------------
+static dpiSubscrMessageTable *dpiSubscr__copyTables(
+        const dpiSubscrMessageTable *tables, uint32_t numTables,
+        char **structs, char **bytes)
+{
+    dpiSubscrMessageTable *copy;
+    uint32_t i, j;
+
+    if (numTables == 0)
+        return NULL;
+    copy = (dpiSubscrMessageTable*) *structs;
+    *structs += numTables * sizeof(dpiSubscrMessageTable);
+    for (i = 0; i < numTables; i++) {
+        copy[i] = tables[i];
+        copy[i].name = dpiSubscr__copyBytes(tables[i].name,
+                tables[i].nameLength, bytes);
+        if (tables[i].numRows == 0) {
+            copy[i].rows = NULL;
+            continue;
+        }
+        copy[i].rows = (dpiSubscrMessageRow*) *structs;
+        *structs += tables[i].numRows * sizeof(dpiSubscrMessageRow);
+        for (j = 0; j < tables[i].numRows; j++) {
+            copy[i].rows[j] = tables[i].rows[j];
+            copy[i].rows[j].rowid =
+                    dpiSubscr__copyBytes(tables[i].rows[j].rowid,
+                    tables[i].rows[j].rowidLength, bytes);
+        }
+    }
+
+    return copy;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSubscr__create() [INTERNAL]
 //   Create a new subscription structure and return it. In case of error NULL
@@ -121,8 +400,20 @@ int dpiSubscr__create(dpiSubscr *subscr, dpiConn *conn,
     subscr->subscrNamespace = params->subscrNamespace;
     subscr->qos = params->qos;
     subscr->clientInitiated = params->clientInitiated;
+    if (conn->env->context->dpiMinorVersion > 0) {
+        subscr->maxQueuedMessages = params->maxQueuedMessages;
+        subscr->coalesceWindow = params->coalesceWindow;
+        subscr->coalesceRowThreshold = params->coalesceRowThreshold;
+    }
     dpiMutex__initialize(subscr->mutex);
 
+    // allocate the queue used for holding messages, if applicable
+    if (subscr->maxQueuedMessages > 0 &&
+            dpiUtils__allocateMemory(subscr->maxQueuedMessages,
+                    sizeof(dpiSubscrMessage*), 1, "allocate message queue",
+                    (void**) &subscr->queue, error) < 0)
+        return DPI_FAILURE;
+
     // create the subscription handle
     if (dpiOci__handleAlloc(conn->env->handle, &subscr->handle,
             DPI_OCI_HTYPE_SUBSCRIPTION, "create subscr handle", error) < 0)
@@ -165,8 +456,9 @@ int dpiSubscr__create(dpiSubscr *subscr, dpiConn *conn,
             error) < 0)
         return DPI_FAILURE;
 
-    // set the callback, if applicable
-    if (params->callback && dpiOci__attrSet(subscr->handle,
+    // set the callback, if applicable; queued messages always require it
+    if ((params->callback || subscr->maxQueuedMessages > 0) &&
+            dpiOci__attrSet(subscr->handle,
             DPI_OCI_HTYPE_SUBSCRIPTION, (void*) dpiSubscr__callback, 0,
             DPI_OCI_ATTR_SUBSCR_CALLBACK, "set callback", error) < 0)
         return DPI_FAILURE;
@@ -279,12 +571,43 @@ int dpiSubscr__create(dpiSubscr *subscr, dpiConn *conn,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSubscr__enqueueMessage() [INTERNAL]
+//   Place a copy of the message on the queue. The subscription lock is
+// expected to be held. If the queue is full or the copy cannot be made, the
+// message is discarded and counted so that the application can detect that
+// notifications were missed.
+//-----------------------------------------------------------------------------
+static void dpiSubscr__enqueueMessage(dpiSubscr *subscr,
+        dpiSubscrMessage *message, dpiError *error)
+{
+    dpiSubscrMessage *copy;
+    uint32_t index;
+
+    if (dpiSubscr__coalesceMessage(subscr, message, error) == DPI_SUCCESS)
+        return;
+    if (subscr->numQueuedMessages == subscr->maxQueuedMessages ||
+            dpiSubscr__copyMessage(message, &copy, error) < 0) {
+        subscr->numDroppedMessages++;
+        return;
+    }
+    index = (subscr->queueStart + subscr->numQueuedMessages) %
+            subscr->maxQueuedMessages;
+    subscr->queue[index] = copy;
+    subscr->numQueuedMessages++;
+    if (subscr->coalesceWindow > 0)
+        subscr->lastQueuedTime = dpiUtils__getMilliseconds();
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSubscr__free() [INTERNAL]
 //   Free the memory and any resources associated with the subscription.
 //-----------------------------------------------------------------------------
 void dpiSubscr__free(dpiSubscr *subscr, dpiError *error)
 {
+    uint32_t i;
+
     dpiMutex__acquire(subscr->mutex);
     if (subscr->handle) {
         if (subscr->registered)
@@ -296,6 +619,13 @@ void dpiSubscr__free(dpiSubscr *subscr, dpiError *error)
         dpiGen__setRefCount(subscr->conn, error, -1);
         subscr->conn = NULL;
     }
+    if (subscr->queue) {
+        for (i = 0; i < subscr->numQueuedMessages; i++)
+            dpiUtils__freeMemory(subscr->queue[(subscr->queueStart + i) %
+                    subscr->maxQueuedMessages]);
+        dpiUtils__freeMemory(subscr->queue);
+        subscr->queue = NULL;
+    }
     dpiMutex__release(subscr->mutex);
     dpiMutex__destroy(subscr->mutex);
     dpiUtils__freeMemory(subscr);
@@ -337,6 +667,29 @@ static void dpiSubscr__freeMessage(dpiSubscrMessage *message)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSubscr__getTablesSize() [INTERNAL]
+//   Return the size of the structures required to copy the array of message
+// tables and increment the size of the data referenced by them.
+//-----------------------------------------------------------------------------
+static size_t dpiSubscr__getTablesSize(const dpiSubscrMessageTable *tables,
+        uint32_t numTables, size_t *bytesSize)
+{
+    size_t structsSize;
+    uint32_t i, j;
+
+    structsSize = numTables * sizeof(dpiSubscrMessageTable);
+    for (i = 0; i < numTables; i++) {
+        *bytesSize += tables[i].nameLength;
+        structsSize += tables[i].numRows * sizeof(dpiSubscrMessageRow);
+        for (j = 0; j < tables[i].numRows; j++)
+            *bytesSize += tables[i].rows[j].rowidLength;
+    }
+
+    return structsSize;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSubscr__populateAQMessage() [INTERNAL]
 //   Populate message with details.
@@ -597,9 +950,15 @@ static int dpiSubscr__populateMessageTable(dpiSubscr *subscr,
             error) < 0)
         return DPI_FAILURE;
 
-    // determine number of rows in collection
+    // determine number of rows in collection; if the number of rows exceeds
+    // the coalescing threshold, the table is reported as "all rows" instead
     if (dpiOci__collSize(subscr->conn, rows, &numRows, error) < 0)
         return DPI_FAILURE;
+    if (subscr->coalesceRowThreshold > 0 &&
+            (uint32_t) numRows > subscr->coalesceRowThreshold) {
+        table->operation |= DPI_OPCODE_ALL_ROWS;
+        return DPI_SUCCESS;
+    }
 
     // allocate memory for row entries
     if (dpiUtils__allocateMemory((size_t) numRows, sizeof(dpiSubscrMessageRow),
@@ -702,6 +1061,70 @@ int dpiSubscr_addRef(dpiSubscr *subscr)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiSubscr_dequeueMessage() [PUBLIC]
+//   Remove the oldest message from the queue and return it. If no messages
+// are queued, NULL is returned.
+//-----------------------------------------------------------------------------
+int dpiSubscr_dequeueMessage(dpiSubscr *subscr, dpiSubscrMessage **message)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(subscr, DPI_HTYPE_SUBSCR, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(subscr, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(subscr, message)
+    *message = NULL;
+    dpiMutex__acquire(subscr->mutex);
+    if (subscr->numQueuedMessages > 0) {
+        *message = subscr->queue[subscr->queueStart];
+        subscr->queue[subscr->queueStart] = NULL;
+        subscr->queueStart = (subscr->queueStart + 1) %
+                subscr->maxQueuedMessages;
+        subscr->numQueuedMessages--;
+    }
+    dpiMutex__release(subscr->mutex);
+    return dpiGen__endPublicFn(subscr, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSubscr_freeMessage() [PUBLIC]
+//   Free a message that was returned by dpiSubscr_dequeueMessage().
+//-----------------------------------------------------------------------------
+int dpiSubscr_freeMessage(dpiSubscr *subscr, dpiSubscrMessage *message)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(subscr, DPI_HTYPE_SUBSCR, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(subscr, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(subscr, message)
+    dpiUtils__freeMemory(message);
+    return dpiGen__endPublicFn(subscr, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSubscr_getNumDroppedMessages() [PUBLIC]
+//   Return the number of messages that were discarded because the queue was
+// full when the notification was received.
+//-----------------------------------------------------------------------------
+int dpiSubscr_getNumDroppedMessages(dpiSubscr *subscr, uint64_t *value)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(subscr, DPI_HTYPE_SUBSCR, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(subscr, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(subscr, value)
+    dpiMutex__acquire(subscr->mutex);
+    *value = subscr->numDroppedMessages;
+    dpiMutex__release(subscr->mutex);
+    return dpiGen__endPublicFn(subscr, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiSubscr_prepareStmt() [PUBLIC]
 //   Prepare statement for registration with subscription.
@@ -188,6 +188,25 @@ int dpiUtils__getAttrStringWithDup(const char *action, const void *ociHandle,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiUtils__getMilliseconds() [INTERNAL]
+//   Return the current time in milliseconds. The value is only meaningful
+// when compared to other values returned by this function.
+//-----------------------------------------------------------------------------
+uint64_t dpiUtils__getMilliseconds(void)
+{
+#ifdef _WIN32
+    return (uint64_t) GetTickCount64();
+#else
+    struct timeval timeOfDay;
+
+    gettimeofday(&timeOfDay, NULL);
+    return (uint64_t) timeOfDay.tv_sec * 1000 +
+            (uint64_t) timeOfDay.tv_usec / 1000;
+#endif
+}
+
+
 #ifdef _WIN32
 //-----------------------------------------------------------------------------
 // dpiUtils__getWindowsError() [INTERNAL]
@@ -503,6 +522,30 @@ int dpiUtils__parseOracleNumber(void *oracleValue, int *isNegative,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiUtils__reallocateMemory() [INTERNAL]
+//   Method for changing the size of memory previously allocated which permits
+// tracing and populates the error structure in the event of a memory
+// allocation failure. The contents of the memory are retained up to the
+// lesser of the old and new sizes. If the allocation fails, the original
+// memory remains valid and is not freed.
+//-----------------------------------------------------------------------------
+int dpiUtils__reallocateMemory(size_t size, const char *action, void **ptr,
+        dpiError *error)
+{
+    void *tempPtr;
+
+    tempPtr = realloc(*ptr, size);
+    if (!tempPtr)
+        return dpiError__set(error, action, DPI_ERR_NO_MEMORY);
+    if (dpiDebugLevel & DPI_DEBUG_LEVEL_MEM)
+        dpiDebug__print("reallocated %u bytes at %p from %p (%s)\n", size,
+                tempPtr, *ptr, action);
+    *ptr = tempPtr;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiUtils__setAttributesFromCommonCreateParams() [INTERNAL]
 //   Set the attributes on the authorization info structure or session handle
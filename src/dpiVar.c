@@ -30,14 +30,23 @@
 #include "dpiImpl.h"
 
 // forward declarations of internal functions only used in this file
+static int dpiVar__getColumn(dpiVar *var, uint32_t pos, uint32_t numValues,
+        void *values, uint32_t *valuesLength, uint32_t *offsets,
+        uint8_t *nullBitmap, dpiError *error);
+static size_t dpiVar__getCopyableValueSize(dpiVar *var);
+static int dpiVar__getVectorRowSize(dpiVectorFormat format,
+        uint32_t numDimensions, size_t *rowSize, dpiError *error);
+static int dpiVar__getNextChunk(dpiDynamicBytes *dynBytes,
+        dpiDynamicBytesChunk **chunk, dpiError *error);
 static int dpiVar__initBuffer(dpiVar *var, dpiVarBuffer *buffer,
         dpiError *error);
 static int dpiVar__setBytesFromDynamicBytes(dpiBytes *bytes,
         dpiDynamicBytes *dynBytes, dpiError *error);
 static int dpiVar__setBytesFromLob(dpiBytes *bytes, dpiDynamicBytes *dynBytes,
         dpiLob *lob, dpiError *error);
-static int dpiVar__setFromBytes(dpiVar *var, uint32_t pos, const char *value,
-        uint32_t valueLength, dpiError *error);
+static int dpiVar__setFromColumn(dpiVar *var, uint32_t pos,
+        uint32_t numValues, const void *values, const uint32_t *offsets,
+        const uint8_t *nullBitmap, dpiError *error);
 static int dpiVar__setFromJson(dpiVar *var, uint32_t pos, dpiJson *json,
         dpiError *error);
 static int dpiVar__setFromLob(dpiVar *var, uint32_t pos, dpiLob *lob,
@@ -50,6 +59,11 @@ static int dpiVar__setFromStmt(dpiVar *var, uint32_t pos, dpiStmt *stmt,
         dpiError *error);
 static int dpiVar__setFromVector(dpiVar *var, uint32_t pos, dpiVector *vector,
         dpiError *error);
+static int dpiVar__setFromVectorMatrix(dpiVar *var, uint32_t pos,
+        uint32_t numRows, dpiVectorFormat format, uint32_t numDimensions,
+        const void *values, const uint32_t *rowOffsets,
+        const uint32_t *sparseIndices, const uint8_t *nullBitmap,
+        dpiError *error);
 static int dpiVar__validateTypes(const dpiOracleType *oracleType,
         dpiNativeTypeNum nativeTypeNum, dpiError *error);
 
@@ -143,14 +157,16 @@ int dpiVar__allocate(dpiConn *conn, dpiOracleTypeNum oracleTypeNum,
 
 //-----------------------------------------------------------------------------
 // dpiVar__allocateChunks() [INTERNAL]
-//   Allocate more chunks for handling dynamic bytes.
+//   Allocate more chunks for handling dynamic bytes. The number of chunks
+// doubles each time so that the array of chunks is copied only rarely.
 //-----------------------------------------------------------------------------
 static int dpiVar__allocateChunks(dpiDynamicBytes *dynBytes, dpiError *error)
 {
     dpiDynamicBytesChunk *chunks;
     uint32_t allocatedChunks;
 
-    allocatedChunks = dynBytes->allocatedChunks + 8;
+    allocatedChunks = (dynBytes->allocatedChunks == 0) ? 8 :
+            dynBytes->allocatedChunks * 2;
     if (dpiUtils__allocateMemory(allocatedChunks, sizeof(dpiDynamicBytesChunk),
             1, "allocate chunks", (void**) &chunks, error) < 0)
         return DPI_FAILURE;
@@ -169,11 +185,15 @@ static int dpiVar__allocateChunks(dpiDynamicBytes *dynBytes, dpiError *error)
 // dpiVar__allocateDynamicBytes() [INTERNAL]
 //   Allocate space in the dynamic bytes structure for the specified number of
 // bytes. When complete, there will be exactly one allocated chunk of the
-// specified size or greater in the dynamic bytes structure.
+// specified size or greater in the dynamic bytes structure. When the chunk
+// needs to grow, its size is at least doubled so that values which grow
+// gradually from one row to the next do not require an allocation each time.
 //-----------------------------------------------------------------------------
 static int dpiVar__allocateDynamicBytes(dpiDynamicBytes *dynBytes,
         uint32_t size, dpiError *error)
 {
+    uint64_t allocatedLength;
+
     // if an error occurs, none of the original space is valid
     dynBytes->numChunks = 0;
 
@@ -186,20 +206,50 @@ static int dpiVar__allocateDynamicBytes(dpiDynamicBytes *dynBytes,
     // resulted in multiple chunks would have been consolidated already
     // make sure that chunk has enough space in it
     if (size > dynBytes->chunks->allocatedLength) {
-        if (dynBytes->chunks->ptr)
+        if (dynBytes->chunks->ptr) {
             dpiUtils__freeMemory(dynBytes->chunks->ptr);
-        dynBytes->chunks->allocatedLength =
-                (size + DPI_DYNAMIC_BYTES_CHUNK_SIZE - 1) &
-                        ~(DPI_DYNAMIC_BYTES_CHUNK_SIZE - 1);
-        if (dpiUtils__allocateMemory(1, dynBytes->chunks->allocatedLength, 0,
+            dynBytes->chunks->ptr = NULL;
+        }
+        allocatedLength = (uint64_t) dynBytes->chunks->allocatedLength * 2;
+        if (allocatedLength < size)
+            allocatedLength = size;
+        allocatedLength =
+                (allocatedLength + DPI_DYNAMIC_BYTES_CHUNK_SIZE - 1) &
+                ~((uint64_t) DPI_DYNAMIC_BYTES_CHUNK_SIZE - 1);
+        if (allocatedLength > UINT_MAX)
+            allocatedLength = size;
+        dynBytes->chunks->allocatedLength = 0;
+        if (dpiUtils__allocateMemory(1, (size_t) allocatedLength, 0,
                 "allocate chunk", (void**) &dynBytes->chunks->ptr, error) < 0)
             return DPI_FAILURE;
+        dynBytes->chunks->allocatedLength = (uint32_t) allocatedLength;
     }
 
     return DPI_SUCCESS;
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__allocateLastSetData() [INTERNAL]
+//   Allocate the copies of the values last transferred to the Oracle buffer,
+// if they have not already been allocated.
+//-----------------------------------------------------------------------------
+static int dpiVar__allocateLastSetData(dpiVarBuffer *buffer, dpiError *error)
+{
+    if (buffer->lastSetData)
+        return DPI_SUCCESS;
+    if (dpiUtils__allocateMemory(buffer->maxArraySize, sizeof(dpiData), 0,
+            "allocate last set data", (void**) &buffer->lastSetData,
+            error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(buffer->maxArraySize, sizeof(uint8_t), 1,
+            "allocate last set data flags",
+            (void**) &buffer->lastSetDataIsValid, error) < 0)
+        return DPI_FAILURE;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar__assignCallbackBuffer() [INTERNAL]
 //   Assign callback pointers during OCI statement execution. This is used with
@@ -365,26 +415,11 @@ int32_t dpiVar__defineCallback(dpiVar *var, UNUSED void *defnp, uint32_t iter,
         uint16_t **rcodepp)
 {
     dpiDynamicBytesChunk *chunk;
-    dpiDynamicBytes *bytes;
 
-    // allocate more chunks, if necessary
-    bytes = &var->buffer.dynamicBytes[iter];
-    if (bytes->numChunks == bytes->allocatedChunks &&
-            dpiVar__allocateChunks(bytes, var->error) < 0)
+    // acquire the next chunk and return it to OCI
+    if (dpiVar__getNextChunk(&var->buffer.dynamicBytes[iter], &chunk,
+            var->error) < 0)
         return DPI_OCI_ERROR;
-
-    // allocate memory for the chunk, if needed
-    chunk = &bytes->chunks[bytes->numChunks];
-    if (!chunk->ptr) {
-        chunk->allocatedLength = DPI_DYNAMIC_BYTES_CHUNK_SIZE;
-        if (dpiUtils__allocateMemory(1, chunk->allocatedLength, 0,
-                "allocate chunk", (void**) &chunk->ptr, var->error) < 0)
-            return DPI_OCI_ERROR;
-    }
-
-    // return chunk to OCI
-    bytes->numChunks++;
-    chunk->length = chunk->allocatedLength;
     *bufpp = chunk->ptr;
     *alenpp = &chunk->length;
     *indpp = &(var->buffer.indicator[iter]);
@@ -518,6 +553,16 @@ int dpiVar__extendedPreFetch(dpiVar *var, dpiVarBuffer *buffer,
         case DPI_ORACLE_TYPE_VECTOR:
             for (i = 0; i < buffer->maxArraySize; i++) {
                 data = &buffer->externalData[i];
+
+                // a vector that is only referenced by the variable can be
+                // reused once the dimensions cached in it are cleared
+                vector = buffer->references[i].asVector;
+                if (vector && vector->refCount == 1) {
+                    dpiVector__clearDimensions(vector);
+                    data->value.asVector = vector;
+                    continue;
+                }
+
                 if (buffer->references[i].asVector) {
                     dpiGen__setRefCount(buffer->references[i].asVector,
                             error, -1);
@@ -625,6 +670,14 @@ static void dpiVar__finalizeBuffer(dpiVar *var, dpiVarBuffer *buffer,
         dpiUtils__freeMemory(buffer->externalData);
         buffer->externalData = NULL;
     }
+    if (buffer->lastSetData) {
+        dpiUtils__freeMemory(buffer->lastSetData);
+        buffer->lastSetData = NULL;
+    }
+    if (buffer->lastSetDataIsValid) {
+        dpiUtils__freeMemory(buffer->lastSetDataIsValid);
+        buffer->lastSetDataIsValid = NULL;
+    }
     if (buffer->data.asRaw) {
         dpiUtils__freeMemory(buffer->data.asRaw);
         buffer->data.asRaw = NULL;
@@ -667,6 +720,217 @@ void dpiVar__free(dpiVar *var, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__getColumn() [PRIVATE]
+//   Copy the values of the variable starting at the given array position to a
+// column of values, in the same layout as that accepted by
+// dpiVar__setFromColumn(). Byte strings are copied one after the other into
+// the values buffer; if that buffer is too small, the length required is
+// returned along with an error so that the caller can try again.
+//-----------------------------------------------------------------------------
+static int dpiVar__getColumn(dpiVar *var, uint32_t pos, uint32_t numValues,
+        void *values, uint32_t *valuesLength, uint32_t *offsets,
+        uint8_t *nullBitmap, dpiError *error)
+{
+    dpiData *data = &var->buffer.externalData[pos];
+    uint64_t requiredLength;
+    uint32_t i, offset;
+    size_t valueSize;
+
+    // clear the null bitmap; bits are set below for values that are not null
+    if (nullBitmap)
+        memset(nullBitmap, 0, (numValues + 7) / 8);
+
+    // when the Oracle buffer holds the native values unchanged, the values are
+    // copied from it directly and the null bitmap is built from the
+    // indicators; null values are returned as zero
+    valueSize = dpiVar__getCopyableValueSize(var);
+    if (valueSize > 0) {
+        memcpy(values, (char*) var->buffer.data.asRaw +
+                (size_t) pos * valueSize, (size_t) numValues * valueSize);
+        for (i = 0; i < numValues; i++) {
+            if (var->buffer.indicator[pos + i] == DPI_OCI_IND_NULL)
+                memset((char*) values + i * valueSize, 0, valueSize);
+            else if (nullBitmap)
+                nullBitmap[i >> 3] |= (uint8_t) (1 << (i & 7));
+        }
+        return DPI_SUCCESS;
+    }
+
+    // byte strings are copied to the values buffer one after the other
+    if (var->nativeTypeNum == DPI_NATIVE_TYPE_BYTES) {
+        requiredLength = 0;
+        for (i = 0; i < numValues; i++) {
+            if (!data[i].isNull)
+                requiredLength += data[i].value.asBytes.length;
+        }
+        if (requiredLength > *valuesLength) {
+            dpiError__set(error, "check buffer size",
+                    DPI_ERR_BUFFER_SIZE_TOO_SMALL, *valuesLength);
+            *valuesLength = (requiredLength > UINT_MAX) ? UINT_MAX :
+                    (uint32_t) requiredLength;
+            return DPI_FAILURE;
+        }
+        for (i = 0, offset = 0; i < numValues; i++, data++) {
+            offsets[i] = offset;
+            if (data->isNull)
+                continue;
+            if (nullBitmap)
+                nullBitmap[i >> 3] |= (uint8_t) (1 << (i & 7));
+            if (data->value.asBytes.length > 0)
+                memcpy((char*) values + offset, data->value.asBytes.ptr,
+                        data->value.asBytes.length);
+            offset += data->value.asBytes.length;
+        }
+        offsets[numValues] = offset;
+        *valuesLength = offset;
+        return DPI_SUCCESS;
+    }
+
+    // all other values are copied to an array of the native type
+    for (i = 0; i < numValues; i++, data++) {
+        if (!data->isNull && nullBitmap)
+            nullBitmap[i >> 3] |= (uint8_t) (1 << (i & 7));
+        switch (var->nativeTypeNum) {
+            case DPI_NATIVE_TYPE_INT64:
+                ((int64_t*) values)[i] = (data->isNull) ? 0 :
+                        data->value.asInt64;
+                break;
+            case DPI_NATIVE_TYPE_UINT64:
+                ((uint64_t*) values)[i] = (data->isNull) ? 0 :
+                        data->value.asUint64;
+                break;
+            case DPI_NATIVE_TYPE_FLOAT:
+                ((float*) values)[i] = (data->isNull) ? 0 :
+                        data->value.asFloat;
+                break;
+            case DPI_NATIVE_TYPE_DOUBLE:
+                ((double*) values)[i] = (data->isNull) ? 0 :
+                        data->value.asDouble;
+                break;
+            case DPI_NATIVE_TYPE_BOOLEAN:
+                ((int*) values)[i] = (data->isNull) ? 0 :
+                        data->value.asBoolean;
+                break;
+            default:
+                return dpiError__set(error, "native type",
+                        DPI_ERR_NOT_SUPPORTED);
+        }
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getCopyableValueSize() [PRIVATE]
+//   Return the size of each value if the Oracle buffer holds values of the
+// variable's native type unchanged, so that a column of values can be copied
+// to it directly; otherwise, 0 is returned.
+//-----------------------------------------------------------------------------
+static size_t dpiVar__getCopyableValueSize(dpiVar *var)
+{
+    if (var->isDynamic || var->dynBindBuffers)
+        return 0;
+    switch (var->type->oracleTypeNum) {
+        case DPI_ORACLE_TYPE_NATIVE_INT:
+            if (var->nativeTypeNum == DPI_NATIVE_TYPE_INT64)
+                return sizeof(int64_t);
+            break;
+        case DPI_ORACLE_TYPE_NATIVE_UINT:
+            if (var->nativeTypeNum == DPI_NATIVE_TYPE_UINT64)
+                return sizeof(uint64_t);
+            break;
+        case DPI_ORACLE_TYPE_NATIVE_FLOAT:
+            if (var->nativeTypeNum == DPI_NATIVE_TYPE_FLOAT)
+                return sizeof(float);
+            break;
+        case DPI_ORACLE_TYPE_NATIVE_DOUBLE:
+            if (var->nativeTypeNum == DPI_NATIVE_TYPE_DOUBLE)
+                return sizeof(double);
+            break;
+        case DPI_ORACLE_TYPE_BOOLEAN:
+            if (var->nativeTypeNum == DPI_NATIVE_TYPE_BOOLEAN)
+                return sizeof(int);
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getNextChunk() [INTERNAL]
+//   Return the next chunk of the dynamic bytes structure to be populated by
+// OCI during dynamic binding or fetching. New chunks are at least as large as
+// all of the chunks that precede them, so that a value requires only a few
+// pieces and the buffer that results when they are consolidated is large
+// enough to be reused without further pieces for values of a similar size.
+//-----------------------------------------------------------------------------
+static int dpiVar__getNextChunk(dpiDynamicBytes *dynBytes,
+        dpiDynamicBytesChunk **chunk, dpiError *error)
+{
+    uint64_t allocatedLength;
+    uint32_t i;
+
+    // allocate more chunks, if necessary
+    if (dynBytes->numChunks == dynBytes->allocatedChunks &&
+            dpiVar__allocateChunks(dynBytes, error) < 0)
+        return DPI_FAILURE;
+
+    // allocate memory for the chunk, if needed
+    *chunk = &dynBytes->chunks[dynBytes->numChunks];
+    if (!(*chunk)->ptr) {
+        allocatedLength = 0;
+        for (i = 0; i < dynBytes->numChunks; i++)
+            allocatedLength += dynBytes->chunks[i].allocatedLength;
+        if (allocatedLength < DPI_DYNAMIC_BYTES_CHUNK_SIZE)
+            allocatedLength = DPI_DYNAMIC_BYTES_CHUNK_SIZE;
+        else if (allocatedLength > DPI_MAX_VAR_BUFFER_SIZE)
+            allocatedLength = DPI_MAX_VAR_BUFFER_SIZE;
+        if (dpiUtils__allocateMemory(1, (size_t) allocatedLength, 0,
+                "allocate chunk", (void**) &(*chunk)->ptr, error) < 0)
+            return DPI_FAILURE;
+        (*chunk)->allocatedLength = (uint32_t) allocatedLength;
+    }
+
+    // the entire chunk is made available to OCI
+    dynBytes->numChunks++;
+    (*chunk)->length = (*chunk)->allocatedLength;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getVectorRowSize() [PRIVATE]
+//   Return the size in bytes of a row of a matrix of vectors with the given
+// format and number of dimensions.
+//-----------------------------------------------------------------------------
+static int dpiVar__getVectorRowSize(dpiVectorFormat format,
+        uint32_t numDimensions, size_t *rowSize, dpiError *error)
+{
+    switch (format) {
+        case DPI_VECTOR_FORMAT_BINARY:
+            *rowSize = numDimensions / 8;
+            break;
+        case DPI_VECTOR_FORMAT_FLOAT32:
+            *rowSize = (size_t) numDimensions * sizeof(float);
+            break;
+        case DPI_VECTOR_FORMAT_FLOAT64:
+            *rowSize = (size_t) numDimensions * sizeof(double);
+            break;
+        case DPI_VECTOR_FORMAT_INT8:
+            *rowSize = (size_t) numDimensions * sizeof(int8_t);
+            break;
+        default:
+            return dpiError__set(error, "check vector format",
+                    DPI_ERR_UNSUPPORTED_VECTOR_FORMAT, format);
+    }
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar__getValue() [PRIVATE]
 //   Returns the contents of the variable in the type specified, if possible.
@@ -679,6 +943,11 @@ int dpiVar__getValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
     dpiData *data;
     uint32_t i;
 
+    // the Oracle buffer may have been modified so any copy of the value last
+    // transferred to it can no longer be used to skip the transfer
+    if (buffer->lastSetDataIsValid)
+        buffer->lastSetDataIsValid[pos] = 0;
+
     // check for dynamic binds first; if they exist, process them instead
     if (var->dynBindBuffers && buffer == &var->buffer) {
         buffer = &var->dynBindBuffers[pos];
@@ -1081,26 +1350,12 @@ int32_t dpiVar__outBindCallback(dpiVar *var, void *bindp, UNUSED uint32_t iter,
     // index is the current index into the chunks
     if (var->isDynamic) {
 
-        // allocate more chunks, if necessary
+        // acquire the next chunk and return it to OCI
         bytes = &buffer->dynamicBytes[index];
         if (*piecep == DPI_OCI_ONE_PIECE)
             bytes->numChunks = 0;
-        if (bytes->numChunks == bytes->allocatedChunks &&
-                dpiVar__allocateChunks(bytes, var->error) < 0)
+        if (dpiVar__getNextChunk(bytes, &chunk, var->error) < 0)
             return DPI_OCI_ERROR;
-
-        // allocate memory for the chunk, if needed
-        chunk = &bytes->chunks[bytes->numChunks];
-        if (!chunk->ptr) {
-            chunk->allocatedLength = DPI_DYNAMIC_BYTES_CHUNK_SIZE;
-            if (dpiUtils__allocateMemory(1, chunk->allocatedLength, 0,
-                    "allocate chunk", (void**) &chunk->ptr, var->error) < 0)
-                return DPI_OCI_ERROR;
-        }
-
-        // return chunk to OCI
-        bytes->numChunks++;
-        chunk->length = chunk->allocatedLength;
         *bufpp = chunk->ptr;
         *alenpp = &chunk->length;
         *indpp = &(buffer->indicator[index]);
@@ -1135,12 +1390,17 @@ int32_t dpiVar__outBindCallback(dpiVar *var, void *bindp, UNUSED uint32_t iter,
 // dpiVar__setBytesFromDynamicBytes() [PRIVATE]
 //   Set the pointer and length in the dpiBytes structure to the values
 // retrieved from the database. At this point, if multiple chunks exist, they
-// are combined into one.
+// are combined into the first chunk, which is extended to hold all of them;
+// the data in the first chunk is retained and the data in the remaining
+// chunks is copied once. The first chunk is then reused for subsequent
+// values.
 //-----------------------------------------------------------------------------
 static int dpiVar__setBytesFromDynamicBytes(dpiBytes *bytes,
         dpiDynamicBytes *dynBytes, dpiError *error)
 {
-    uint32_t i, totalAllocatedLength;
+    uint64_t totalAllocatedLength;
+    dpiDynamicBytesChunk *chunk;
+    uint32_t i;
 
     // if only one chunk is available, make use of it
     if (dynBytes->numChunks == 1) {
@@ -1149,33 +1409,43 @@ static int dpiVar__setBytesFromDynamicBytes(dpiBytes *bytes,
         return DPI_SUCCESS;
     }
 
+    // if no chunks are available, the value is empty
+    if (dynBytes->numChunks == 0) {
+        bytes->ptr = (dynBytes->chunks) ? dynBytes->chunks->ptr : NULL;
+        bytes->length = 0;
+        return DPI_SUCCESS;
+    }
+
     // determine total allocated size of all chunks
     totalAllocatedLength = 0;
     for (i = 0; i < dynBytes->numChunks; i++)
         totalAllocatedLength += dynBytes->chunks[i].allocatedLength;
+    if (totalAllocatedLength > UINT_MAX)
+        return dpiError__set(error, "check consolidated length",
+                DPI_ERR_NOT_SUPPORTED);
 
-    // allocate new memory consolidating all of the chunks
-    if (dpiUtils__allocateMemory(1, totalAllocatedLength, 0,
-            "allocate consolidated chunk", (void**) &bytes->ptr, error) < 0)
+    // extend the first chunk so that it can hold all of the chunks
+    chunk = dynBytes->chunks;
+    if (dpiUtils__reallocateMemory((size_t) totalAllocatedLength,
+            "extend consolidated chunk", (void**) &chunk->ptr, error) < 0)
         return DPI_FAILURE;
+    chunk->allocatedLength = (uint32_t) totalAllocatedLength;
 
-    // copy memory from chunks to consolidated chunk
-    bytes->length = 0;
-    for (i = 0; i < dynBytes->numChunks; i++) {
-        memcpy(bytes->ptr + bytes->length, dynBytes->chunks[i].ptr,
+    // copy memory from the remaining chunks to the first chunk
+    for (i = 1; i < dynBytes->numChunks; i++) {
+        memcpy(chunk->ptr + chunk->length, dynBytes->chunks[i].ptr,
                 dynBytes->chunks[i].length);
-        bytes->length += dynBytes->chunks[i].length;
+        chunk->length += dynBytes->chunks[i].length;
         dpiUtils__freeMemory(dynBytes->chunks[i].ptr);
         dynBytes->chunks[i].ptr = NULL;
         dynBytes->chunks[i].length = 0;
         dynBytes->chunks[i].allocatedLength = 0;
     }
 
-    // populate first chunk with consolidated information
+    // populate bytes with consolidated information
     dynBytes->numChunks = 1;
-    dynBytes->chunks->ptr = bytes->ptr;
-    dynBytes->chunks->length = bytes->length;
-    dynBytes->chunks->allocatedLength = totalAllocatedLength;
+    bytes->ptr = chunk->ptr;
+    bytes->length = chunk->length;
 
     return DPI_SUCCESS;
 }
@@ -1221,12 +1491,12 @@ static int dpiVar__setBytesFromLob(dpiBytes *bytes, dpiDynamicBytes *dynBytes,
 
 
 //-----------------------------------------------------------------------------
-// dpiVar__setFromBytes() [PRIVATE]
+// dpiVar__setFromBytes() [INTERNAL]
 //   Set the value of the variable at the given array position from a byte
 // string. The byte string is not retained in any way. A copy will be made into
 // buffers allocated by ODPI-C.
 //-----------------------------------------------------------------------------
-static int dpiVar__setFromBytes(dpiVar *var, uint32_t pos, const char *value,
+int dpiVar__setFromBytes(dpiVar *var, uint32_t pos, const char *value,
         uint32_t valueLength, dpiError *error)
 {
     dpiData *data = &var->buffer.externalData[pos];
@@ -1283,6 +1553,101 @@ static int dpiVar__setFromBytes(dpiVar *var, uint32_t pos, const char *value,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__setFromColumn() [PRIVATE]
+//   Set the values of the variable starting at the given array position from
+// a column of values. When the Oracle buffer holds the native values
+// unchanged the column is copied to it with a single memcpy(); otherwise each
+// value is converted to the Oracle buffers immediately and the copy retained
+// by dpiVar__setValueIfChanged() ensures that the conversion is not repeated
+// when the statement is executed. Byte strings are supplied as a
+// single buffer with an array of (numValues + 1) offsets into it. The null
+// bitmap, if supplied, contains one bit per value (least significant bit
+// first) which is set when the value is not null.
+//-----------------------------------------------------------------------------
+static int dpiVar__setFromColumn(dpiVar *var, uint32_t pos,
+        uint32_t numValues, const void *values, const uint32_t *offsets,
+        const uint8_t *nullBitmap, dpiError *error)
+{
+    dpiData *data = &var->buffer.externalData[pos];
+    uint32_t i, valueLength;
+    size_t valueSize;
+    int isNull;
+
+    // when the Oracle buffer holds the native values unchanged, the column is
+    // copied to it directly and only the indicators and the external data are
+    // updated for each value; the values are also recorded as transferred so
+    // that they are not transferred again when the statement is executed
+    valueSize = dpiVar__getCopyableValueSize(var);
+    if (valueSize > 0) {
+        if (dpiVar__allocateLastSetData(&var->buffer, error) < 0)
+            return DPI_FAILURE;
+        memcpy((char*) var->buffer.data.asRaw + (size_t) pos * valueSize,
+                values, (size_t) numValues * valueSize);
+        for (i = 0; i < numValues; i++, data++) {
+            isNull = (nullBitmap && !((nullBitmap[i >> 3] >> (i & 7)) & 1));
+            var->buffer.indicator[pos + i] = (isNull) ? DPI_OCI_IND_NULL :
+                    DPI_OCI_IND_NOTNULL;
+            data->isNull = isNull;
+            memcpy(&data->value, (const char*) values + i * valueSize,
+                    valueSize);
+            var->buffer.lastSetData[pos + i] = *data;
+        }
+        memset(&var->buffer.lastSetDataIsValid[pos], 1, numValues);
+        return DPI_SUCCESS;
+    }
+
+    for (i = 0; i < numValues; i++, data++) {
+        isNull = (nullBitmap && !((nullBitmap[i >> 3] >> (i & 7)) & 1));
+        if (var->nativeTypeNum == DPI_NATIVE_TYPE_BYTES ||
+                var->nativeTypeNum == DPI_NATIVE_TYPE_LOB) {
+            if (isNull) {
+                data->isNull = 1;
+                continue;
+            }
+            if (offsets[i + 1] < offsets[i])
+                return dpiError__set(error, "check offsets",
+                        DPI_ERR_INVALID_COLUMN_OFFSETS, i);
+            valueLength = offsets[i + 1] - offsets[i];
+            if (valueLength > DPI_MAX_VAR_BUFFER_SIZE)
+                return dpiError__set(error, "check buffer",
+                        DPI_ERR_BUFFER_SIZE_TOO_LARGE, valueLength,
+                        DPI_MAX_VAR_BUFFER_SIZE);
+            if (dpiVar__setFromBytes(var, pos + i,
+                    (const char*) values + offsets[i], valueLength,
+                    error) < 0)
+                return DPI_FAILURE;
+            continue;
+        }
+        data->isNull = isNull;
+        switch (var->nativeTypeNum) {
+            case DPI_NATIVE_TYPE_INT64:
+                data->value.asInt64 = ((const int64_t*) values)[i];
+                break;
+            case DPI_NATIVE_TYPE_UINT64:
+                data->value.asUint64 = ((const uint64_t*) values)[i];
+                break;
+            case DPI_NATIVE_TYPE_FLOAT:
+                data->value.asFloat = ((const float*) values)[i];
+                break;
+            case DPI_NATIVE_TYPE_DOUBLE:
+                data->value.asDouble = ((const double*) values)[i];
+                break;
+            case DPI_NATIVE_TYPE_BOOLEAN:
+                data->value.asBoolean = ((const int*) values)[i];
+                break;
+            default:
+                return dpiError__set(error, "native type",
+                        DPI_ERR_NOT_SUPPORTED);
+        }
+        if (dpiVar__setValueIfChanged(var, pos + i, error) < 0)
+            return DPI_FAILURE;
+    }
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar__setFromJson() [PRIVATE]
 //   Set the value of the variable at the given array position from a JSON
@@ -1521,6 +1886,90 @@ static int dpiVar__setFromVector(dpiVar *var, uint32_t pos, dpiVector *vector,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__setFromVectorMatrix() [PRIVATE]
+//   Set the values of the variable starting at the given array position from
+// the rows of a matrix of vectors. Dense vectors are supplied as a row-major
+// matrix; sparse vectors are supplied in compressed sparse row form, where
+// the indices and values of row i are found at positions rowOffsets[i] up to
+// rowOffsets[i + 1] of the sparseIndices and values arrays. Each row is
+// transferred to a vector owned by the variable, which is retained for
+// subsequent calls; a vector is only allocated if the array position holds
+// no vector or holds one that is referenced elsewhere.
+//-----------------------------------------------------------------------------
+static int dpiVar__setFromVectorMatrix(dpiVar *var, uint32_t pos,
+        uint32_t numRows, dpiVectorFormat format, uint32_t numDimensions,
+        const void *values, const uint32_t *rowOffsets,
+        const uint32_t *sparseIndices, const uint8_t *nullBitmap,
+        dpiError *error)
+{
+    dpiVarBuffer *buffer = &var->buffer;
+    dpiVectorInfo info;
+    dpiVector *vector;
+    size_t valueSize;
+    dpiData *data;
+    uint32_t i;
+    int status;
+
+    // determine the size of each row (dense) or each value (sparse)
+    if (rowOffsets && format == DPI_VECTOR_FORMAT_BINARY)
+        return dpiError__set(error, "check sparse format",
+                DPI_ERR_NOT_SUPPORTED);
+    if (dpiVar__getVectorRowSize(format, (rowOffsets) ? 1 : numDimensions,
+            &valueSize, error) < 0)
+        return DPI_FAILURE;
+
+    memset(&info, 0, sizeof(info));
+    info.format = format;
+    info.numDimensions = numDimensions;
+    for (i = 0; i < numRows; i++) {
+
+        // null rows only need to be marked as such
+        data = &buffer->externalData[pos + i];
+        if (nullBitmap && !((nullBitmap[i >> 3] >> (i & 7)) & 1)) {
+            data->isNull = 1;
+            continue;
+        }
+
+        // acquire a vector owned only by the variable
+        vector = buffer->references[pos + i].asVector;
+        if (!vector || vector->refCount > 1) {
+            if (dpiVector__allocate(var->conn, &vector, error) < 0)
+                return DPI_FAILURE;
+            if (buffer->references[pos + i].asVector)
+                dpiGen__setRefCount(buffer->references[pos + i].asVector,
+                        error, -1);
+            buffer->references[pos + i].asVector = vector;
+            buffer->data.asVectorDescriptor[pos + i] = vector->handle;
+        }
+        dpiVector__clearDimensions(vector);
+        data->value.asVector = vector;
+        data->isNull = 0;
+
+        // transfer the row to the vector
+        if (rowOffsets) {
+            if (rowOffsets[i + 1] < rowOffsets[i])
+                return dpiError__set(error, "check offsets",
+                        DPI_ERR_INVALID_COLUMN_OFFSETS, i);
+            info.isSparse = 1;
+            info.numSparseValues = rowOffsets[i + 1] - rowOffsets[i];
+            info.sparseIndices = (uint32_t*) &sparseIndices[rowOffsets[i]];
+            info.dimensions.asPtr =
+                    (char*) values + rowOffsets[i] * valueSize;
+            status = dpiOci__vectorFromSparseArray(vector, &info, error);
+        } else {
+            info.dimensions.asPtr = (char*) values + i * valueSize;
+            status = dpiOci__vectorFromArray(vector, &info, error);
+        }
+        if (status < 0)
+            return DPI_FAILURE;
+
+    }
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar__setValue() [PRIVATE]
 //   Sets the contents of the variable using the type specified, if possible.
@@ -1642,6 +2091,73 @@ int dpiVar__setValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__setValueIfChanged() [PRIVATE]
+//   Sets the contents of the variable from the external data at the given
+// position prior to execution. For native types where the value is contained
+// entirely within the dpiData structure, a copy of the value is retained and
+// the conversion is skipped if the value has not changed since it was last
+// transferred and the Oracle buffer has not been modified since then.
+//-----------------------------------------------------------------------------
+int dpiVar__setValueIfChanged(dpiVar *var, uint32_t pos, dpiError *error)
+{
+    dpiVarBuffer *buffer = &var->buffer;
+    dpiData *data = &buffer->externalData[pos], *lastData;
+    size_t valueSize;
+
+    // determine if the value can be compared
+    switch (var->nativeTypeNum) {
+        case DPI_NATIVE_TYPE_INT64:
+        case DPI_NATIVE_TYPE_UINT64:
+            valueSize = sizeof(int64_t);
+            break;
+        case DPI_NATIVE_TYPE_FLOAT:
+            valueSize = sizeof(float);
+            break;
+        case DPI_NATIVE_TYPE_DOUBLE:
+            valueSize = sizeof(double);
+            break;
+        case DPI_NATIVE_TYPE_BOOLEAN:
+            valueSize = sizeof(int);
+            break;
+        case DPI_NATIVE_TYPE_TIMESTAMP:
+            if (var->type->oracleTypeNum == DPI_ORACLE_TYPE_TIMESTAMP_LTZ)
+                return dpiVar__setValue(var, buffer, pos, data, error);
+            valueSize = sizeof(dpiTimestamp);
+            break;
+        case DPI_NATIVE_TYPE_INTERVAL_DS:
+            valueSize = sizeof(dpiIntervalDS);
+            break;
+        case DPI_NATIVE_TYPE_INTERVAL_YM:
+            valueSize = sizeof(dpiIntervalYM);
+            break;
+        default:
+            return dpiVar__setValue(var, buffer, pos, data, error);
+    }
+    if (var->isDynamic)
+        return dpiVar__setValue(var, buffer, pos, data, error);
+
+    // allocate memory for the copies of the values, if needed
+    if (dpiVar__allocateLastSetData(buffer, error) < 0)
+        return DPI_FAILURE;
+
+    // if the value is unchanged, nothing needs to be done
+    lastData = &buffer->lastSetData[pos];
+    if (buffer->lastSetDataIsValid[pos] && data->isNull == lastData->isNull &&
+            (data->isNull || memcmp(&data->value, &lastData->value,
+                    valueSize) == 0))
+        return DPI_SUCCESS;
+
+    // transfer the value and retain a copy of it
+    buffer->lastSetDataIsValid[pos] = 0;
+    if (dpiVar__setValue(var, buffer, pos, data, error) < 0)
+        return DPI_FAILURE;
+    memcpy(lastData, data, sizeof(dpiData));
+    buffer->lastSetDataIsValid[pos] = 1;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar__validateTypes() [PRIVATE]
 //   Validate that the Oracle type and the native type are compatible with
@@ -1717,6 +2233,42 @@ int dpiVar_copyData(dpiVar *var, uint32_t pos, dpiVar *sourceVar,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar_getColumn() [PUBLIC]
+//   Copy a contiguous range of the variable's values to a column of values.
+//-----------------------------------------------------------------------------
+int dpiVar_getColumn(dpiVar *var, uint32_t pos, uint32_t numValues,
+        void *values, uint32_t *valuesLength, uint32_t *offsets,
+        uint8_t *nullBitmap)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(var, DPI_HTYPE_VAR, __func__, &error) < 0)
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    if (numValues == 0)
+        return dpiGen__endPublicFn(var, DPI_SUCCESS, &error);
+    if (pos >= var->buffer.maxArraySize ||
+            numValues > var->buffer.maxArraySize - pos) {
+        dpiError__set(&error, "check array size",
+                DPI_ERR_INVALID_ARRAY_POSITION, pos + numValues - 1,
+                var->buffer.maxArraySize);
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    }
+    if (var->nativeTypeNum == DPI_NATIVE_TYPE_BYTES) {
+        DPI_CHECK_PTR_NOT_NULL(var, valuesLength)
+        DPI_CHECK_PTR_NOT_NULL(var, offsets)
+        if (*valuesLength > 0)
+            DPI_CHECK_PTR_NOT_NULL(var, values)
+    } else {
+        DPI_CHECK_PTR_NOT_NULL(var, values)
+    }
+    status = dpiVar__getColumn(var, pos, numValues, values, valuesLength,
+            offsets, nullBitmap, &error);
+    return dpiGen__endPublicFn(var, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar_getNumElementsInArray() [PUBLIC]
 //   Return the actual number of elements in the array. This value is only
@@ -1782,6 +2334,62 @@ int dpiVar_getSizeInBytes(dpiVar *var, uint32_t *sizeInBytes)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar_getVectorMatrix() [PUBLIC]
+//   Copy the dimensions of a contiguous range of dense vectors into a single
+// row-major matrix with one row for each vector.
+//-----------------------------------------------------------------------------
+int dpiVar_getVectorMatrix(dpiVar *var, uint32_t pos, uint32_t numRows,
+        dpiVectorFormat format, uint32_t numDimensions, void *matrix,
+        uint8_t *nullBitmap)
+{
+    size_t rowSize;
+    dpiError error;
+    dpiData *data;
+    uint32_t i;
+
+    if (dpiGen__startPublicFn(var, DPI_HTYPE_VAR, __func__, &error) < 0)
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    if (var->type->oracleTypeNum != DPI_ORACLE_TYPE_VECTOR) {
+        dpiError__set(&error, "check type", DPI_ERR_NOT_SUPPORTED);
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    }
+    if (numRows == 0)
+        return dpiGen__endPublicFn(var, DPI_SUCCESS, &error);
+    if (pos >= var->buffer.maxArraySize ||
+            numRows > var->buffer.maxArraySize - pos) {
+        dpiError__set(&error, "check array size",
+                DPI_ERR_INVALID_ARRAY_POSITION, pos + numRows - 1,
+                var->buffer.maxArraySize);
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    }
+    DPI_CHECK_PTR_NOT_NULL(var, matrix)
+
+    // determine the size of each row of the matrix
+    if (dpiVar__getVectorRowSize(format, numDimensions, &rowSize,
+            &error) < 0)
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+
+    // copy each vector directly to its row; null rows are filled with zeroes
+    if (nullBitmap)
+        memset(nullBitmap, 0, (numRows + 7) / 8);
+    for (i = 0; i < numRows; i++) {
+        data = &var->buffer.externalData[pos + i];
+        if (data->isNull) {
+            memset((char*) matrix + i * rowSize, 0, rowSize);
+            continue;
+        }
+        if (nullBitmap)
+            nullBitmap[i >> 3] |= (uint8_t) (1 << (i & 7));
+        if (dpiVector__copyToBuffer(data->value.asVector, format,
+                numDimensions, (char*) matrix + i * rowSize, &error) < 0)
+            return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    }
+
+    return dpiGen__endPublicFn(var, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar_release() [PUBLIC]
 //   Release a reference to the variable.
@@ -1823,6 +2431,44 @@ int dpiVar_setFromBytes(dpiVar *var, uint32_t pos, const char *value,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar_setFromColumn() [PUBLIC]
+//   Set the values of the variable starting at the given array position from
+// a column of values in a single call. Checks on the array positions, the
+// sizes of the strings and the type of variable will be made. The column is
+// not retained in any way; copies are made into buffers allocated by ODPI-C.
+//-----------------------------------------------------------------------------
+int dpiVar_setFromColumn(dpiVar *var, uint32_t pos, uint32_t numValues,
+        const void *values, const uint32_t *offsets,
+        const uint8_t *nullBitmap)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(var, DPI_HTYPE_VAR, __func__, &error) < 0)
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    if (numValues == 0)
+        return dpiGen__endPublicFn(var, DPI_SUCCESS, &error);
+    if (pos >= var->buffer.maxArraySize ||
+            numValues > var->buffer.maxArraySize - pos) {
+        dpiError__set(&error, "check array size",
+                DPI_ERR_INVALID_ARRAY_POSITION, pos + numValues - 1,
+                var->buffer.maxArraySize);
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    }
+    DPI_CHECK_PTR_NOT_NULL(var, values)
+    if (var->nativeTypeNum == DPI_NATIVE_TYPE_BYTES ||
+            var->nativeTypeNum == DPI_NATIVE_TYPE_LOB)
+        DPI_CHECK_PTR_NOT_NULL(var, offsets)
+    status = dpiVar__setFromColumn(var, pos, numValues, values, offsets,
+            nullBitmap, &error);
+    if (status == DPI_SUCCESS && var->isArray &&
+            pos + numValues > var->buffer.actualArraySize)
+        var->buffer.actualArraySize = pos + numValues;
+    return dpiGen__endPublicFn(var, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar_setFromJson() [PUBLIC]
 //  Set the value of the variable at the given position from a JSON value.
@@ -1955,6 +2601,46 @@ int dpiVar_setFromVector(dpiVar *var, uint32_t pos, dpiVector *vector)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar_setFromVectorMatrix() [PUBLIC]
+//   Set a contiguous range of the variable's values from the rows of a matrix
+// of vectors.
+//-----------------------------------------------------------------------------
+int dpiVar_setFromVectorMatrix(dpiVar *var, uint32_t pos, uint32_t numRows,
+        dpiVectorFormat format, uint32_t numDimensions, const void *values,
+        const uint32_t *rowOffsets, const uint32_t *sparseIndices,
+        const uint8_t *nullBitmap)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(var, DPI_HTYPE_VAR, __func__, &error) < 0)
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    if (var->nativeTypeNum != DPI_NATIVE_TYPE_VECTOR) {
+        dpiError__set(&error, "native type", DPI_ERR_NOT_SUPPORTED);
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    }
+    if (numRows == 0)
+        return dpiGen__endPublicFn(var, DPI_SUCCESS, &error);
+    if (pos >= var->buffer.maxArraySize ||
+            numRows > var->buffer.maxArraySize - pos) {
+        dpiError__set(&error, "check array size",
+                DPI_ERR_INVALID_ARRAY_POSITION, pos + numRows - 1,
+                var->buffer.maxArraySize);
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    }
+    DPI_CHECK_PTR_NOT_NULL(var, values)
+    if (rowOffsets || sparseIndices) {
+        DPI_CHECK_PTR_NOT_NULL(var, rowOffsets)
+        DPI_CHECK_PTR_NOT_NULL(var, sparseIndices)
+    }
+    status = dpiVar__setFromVectorMatrix(var, pos, numRows, format,
+            numDimensions, values, rowOffsets, sparseIndices, nullBitmap,
+            &error);
+    return dpiGen__endPublicFn(var, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar_setNumElementsInArray() [PUBLIC]
 //   Set the number of elements in the array (different from the number of
@@ -29,8 +29,79 @@
 
 #include "dpiImpl.h"
 
+// number of dimensions converted to double at a time when calculating
+// distances between vectors
+#define DPI_VECTOR_BLOCK_SIZE           64
+
 // forward declarations of internal functions only used in this file
-static void dpiVector__clearDimensions(dpiVector *vector);
+static void dpiVector__accumulate(dpiVectorDistanceMetric metric,
+        const double *values1, const double *values2, uint32_t numValues,
+        double *sums);
+static void dpiVector__getBinaryDistance(const dpiVectorInfo *info1,
+        const dpiVectorInfo *info2, dpiVectorDistanceMetric metric,
+        double *distance);
+static void dpiVector__getBlock(const dpiVectorInfo *info, uint32_t start,
+        uint32_t numValues, double *values);
+static double dpiVector__getDimension(const dpiVectorInfo *info,
+        uint32_t pos);
+static int dpiVector__getDistance(const dpiVectorInfo *info1,
+        const dpiVectorInfo *info2, dpiVectorDistanceMetric metric,
+        double *distance, dpiError *error);
+static void dpiVector__getSparseSums(const dpiVectorInfo *info1,
+        const dpiVectorInfo *info2, dpiVectorDistanceMetric metric,
+        double *sums);
+static uint32_t dpiVector__popCount(uint32_t value);
+
+
+//-----------------------------------------------------------------------------
+// dpiVector__accumulate() [INTERNAL]
+//   Add the contribution of a block of pairs of dimensions to the sums from
+// which the distance is calculated. For cosine distance the sums are the dot
+// product followed by the squared magnitude of each vector; for all other
+// metrics only the first sum is used. Local accumulators are used so that the
+// loops do not depend on the memory the sums are stored in.
+//-----------------------------------------------------------------------------
+static void dpiVector__accumulate(dpiVectorDistanceMetric metric,
+        const double *values1, const double *values2, uint32_t numValues,
+        double *sums)
+{
+    double sum0 = 0, sum1 = 0, sum2 = 0, diff;
+    uint32_t i;
+
+    switch (metric) {
+        case DPI_VECTOR_DISTANCE_COSINE:
+            for (i = 0; i < numValues; i++) {
+                sum0 += values1[i] * values2[i];
+                sum1 += values1[i] * values1[i];
+                sum2 += values2[i] * values2[i];
+            }
+            break;
+        case DPI_VECTOR_DISTANCE_DOT:
+            for (i = 0; i < numValues; i++)
+                sum0 += values1[i] * values2[i];
+            break;
+        case DPI_VECTOR_DISTANCE_EUCLIDEAN:
+        case DPI_VECTOR_DISTANCE_EUCLIDEAN_SQUARED:
+            for (i = 0; i < numValues; i++) {
+                diff = values1[i] - values2[i];
+                sum0 += diff * diff;
+            }
+            break;
+        case DPI_VECTOR_DISTANCE_HAMMING:
+            for (i = 0; i < numValues; i++)
+                sum0 += (values1[i] != values2[i]);
+            break;
+        case DPI_VECTOR_DISTANCE_MANHATTAN:
+            for (i = 0; i < numValues; i++) {
+                diff = values1[i] - values2[i];
+                sum0 += (diff < 0) ? -diff : diff;
+            }
+            break;
+    }
+    sums[0] += sum0;
+    sums[1] += sum1;
+    sums[2] += sum2;
+}
 
 //-----------------------------------------------------------------------------
 // dpiVector__allocate() [INTERNAL]
@@ -60,14 +131,48 @@ int dpiVector__allocate(dpiConn *conn, dpiVector **vector, dpiError *error)
 
 //-----------------------------------------------------------------------------
 // dpiVector__clearDimensions() [INTERNAL]
-//   Clear the dimensions cached in the vector.
+//   Clear the dimensions (and sparse indices) cached in the vector so that
+// they are acquired again the next time they are requested.
 //-----------------------------------------------------------------------------
-static void dpiVector__clearDimensions(dpiVector *vector)
+void dpiVector__clearDimensions(dpiVector *vector)
 {
     if (vector->dimensions) {
         dpiUtils__freeMemory(vector->dimensions);
         vector->dimensions = NULL;
     }
+    if (vector->sparseIndices) {
+        dpiUtils__freeMemory(vector->sparseIndices);
+        vector->sparseIndices = NULL;
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVector__copyToBuffer() [INTERNAL]
+//   Copy the dimensions of a dense vector to the supplied buffer in the given
+// format, without caching them in the vector. The vector must have exactly
+// the given number of dimensions.
+//-----------------------------------------------------------------------------
+int dpiVector__copyToBuffer(dpiVector *vector, uint8_t format,
+        uint32_t numDimensions, void *buffer, dpiError *error)
+{
+    uint32_t actualNumDimensions, flags;
+
+    if (dpiOci__attrGet(vector->handle, DPI_OCI_DTYPE_VECTOR,
+            &actualNumDimensions, 0, DPI_OCI_ATTR_VECTOR_DIMENSION,
+            "get number of vector dimensions", error) < 0)
+        return DPI_FAILURE;
+    if (actualNumDimensions != numDimensions)
+        return dpiError__set(error, "check dimensions",
+                DPI_ERR_VECTOR_DIMENSIONS_MISMATCH, actualNumDimensions,
+                numDimensions);
+    if (dpiOci__attrGet(vector->handle, DPI_OCI_DTYPE_VECTOR, &flags, 0,
+            DPI_OCI_ATTR_VECTOR_PROPERTY, "get vector flags", error) < 0)
+        return DPI_FAILURE;
+    if (flags & DPI_OCI_ATTR_VECTOR_COL_PROPERTY_IS_SPARSE)
+        return dpiError__set(error, "check sparse", DPI_ERR_NOT_SUPPORTED);
+    return dpiOci__vectorToArray(vector, format, &actualNumDimensions, buffer,
+            error);
 }
 
 
@@ -90,6 +195,202 @@ void dpiVector__free(dpiVector *vector, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVector__getBinaryDistance() [INTERNAL]
+//   Calculate the distance between two binary vectors, which store eight
+// dimensions in each byte. The bytes are processed four at a time and the
+// bits are counted without the need for a lookup table.
+//-----------------------------------------------------------------------------
+static void dpiVector__getBinaryDistance(const dpiVectorInfo *info1,
+        const dpiVectorInfo *info2, dpiVectorDistanceMetric metric,
+        double *distance)
+{
+    uint32_t i, numBytes, word1, word2, numDiffer, numCommon, numUnion;
+    const uint8_t *bytes1, *bytes2;
+
+    bytes1 = (const uint8_t*) info1->dimensions.asPtr;
+    bytes2 = (const uint8_t*) info2->dimensions.asPtr;
+    numBytes = info1->numDimensions / 8;
+    numDiffer = numCommon = numUnion = 0;
+    for (i = 0; i < numBytes; i += sizeof(uint32_t)) {
+        word1 = word2 = 0;
+        if (numBytes - i >= sizeof(uint32_t)) {
+            memcpy(&word1, &bytes1[i], sizeof(uint32_t));
+            memcpy(&word2, &bytes2[i], sizeof(uint32_t));
+        } else {
+            memcpy(&word1, &bytes1[i], numBytes - i);
+            memcpy(&word2, &bytes2[i], numBytes - i);
+        }
+        if (metric == DPI_VECTOR_DISTANCE_HAMMING) {
+            numDiffer += dpiVector__popCount(word1 ^ word2);
+        } else {
+            numCommon += dpiVector__popCount(word1 & word2);
+            numUnion += dpiVector__popCount(word1 | word2);
+        }
+    }
+    if (metric == DPI_VECTOR_DISTANCE_HAMMING)
+        *distance = numDiffer;
+    else *distance = (numUnion == 0) ? 0 :
+            1 - (double) numCommon / (double) numUnion;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVector__getBlock() [INTERNAL]
+//   Convert a block of the dimensions of a dense vector to double.
+//-----------------------------------------------------------------------------
+static void dpiVector__getBlock(const dpiVectorInfo *info, uint32_t start,
+        uint32_t numValues, double *values)
+{
+    uint32_t i;
+
+    switch (info->format) {
+        case DPI_VECTOR_FORMAT_FLOAT32:
+            for (i = 0; i < numValues; i++)
+                values[i] = info->dimensions.asFloat[start + i];
+            break;
+        case DPI_VECTOR_FORMAT_FLOAT64:
+            memcpy(values, &info->dimensions.asDouble[start],
+                    numValues * sizeof(double));
+            break;
+        case DPI_VECTOR_FORMAT_INT8:
+            for (i = 0; i < numValues; i++)
+                values[i] = info->dimensions.asInt8[start + i];
+            break;
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVector__getDimension() [INTERNAL]
+//   Return the dimension value stored at the given position as a double.
+//-----------------------------------------------------------------------------
+static double dpiVector__getDimension(const dpiVectorInfo *info,
+        uint32_t pos)
+{
+    switch (info->format) {
+        case DPI_VECTOR_FORMAT_FLOAT32:
+            return info->dimensions.asFloat[pos];
+        case DPI_VECTOR_FORMAT_FLOAT64:
+            return info->dimensions.asDouble[pos];
+        case DPI_VECTOR_FORMAT_INT8:
+            return info->dimensions.asInt8[pos];
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVector__getDistance() [INTERNAL]
+//   Calculate the distance between two vectors using the given metric. The
+// semantics match those of the SQL function VECTOR_DISTANCE(); in particular,
+// the dot product distance is the negated dot product.
+//-----------------------------------------------------------------------------
+static int dpiVector__getDistance(const dpiVectorInfo *info1,
+        const dpiVectorInfo *info2, dpiVectorDistanceMetric metric,
+        double *distance, dpiError *error)
+{
+    double values1[DPI_VECTOR_BLOCK_SIZE], values2[DPI_VECTOR_BLOCK_SIZE];
+    double sums[3] = { 0, 0, 0 };
+    uint32_t start, numValues;
+    int isBinary;
+
+    // validate vectors and metric
+    if (info1->numDimensions != info2->numDimensions)
+        return dpiError__set(error, "check dimensions",
+                DPI_ERR_VECTOR_DIMENSIONS_MISMATCH, info1->numDimensions,
+                info2->numDimensions);
+    isBinary = (info1->format == DPI_VECTOR_FORMAT_BINARY);
+    if (isBinary != (info2->format == DPI_VECTOR_FORMAT_BINARY) ||
+            (isBinary && (info1->isSparse || info2->isSparse ||
+                    (metric != DPI_VECTOR_DISTANCE_HAMMING &&
+                    metric != DPI_VECTOR_DISTANCE_JACCARD))) ||
+            (!isBinary && (metric < DPI_VECTOR_DISTANCE_COSINE ||
+                    metric > DPI_VECTOR_DISTANCE_MANHATTAN ||
+                    metric == DPI_VECTOR_DISTANCE_JACCARD)))
+        return dpiError__set(error, "check metric",
+                DPI_ERR_VECTOR_DISTANCE_NOT_SUPPORTED, metric, info1->format,
+                info2->format);
+
+    // binary vectors are compared bit by bit
+    if (isBinary) {
+        dpiVector__getBinaryDistance(info1, info2, metric, distance);
+        return DPI_SUCCESS;
+    }
+
+    // dense vectors are converted to double a block at a time; sparse vectors
+    // only need the dimensions present in either vector to be examined
+    if (!info1->isSparse && !info2->isSparse) {
+        for (start = 0; start < info1->numDimensions; start += numValues) {
+            numValues = info1->numDimensions - start;
+            if (numValues > DPI_VECTOR_BLOCK_SIZE)
+                numValues = DPI_VECTOR_BLOCK_SIZE;
+            dpiVector__getBlock(info1, start, numValues, values1);
+            dpiVector__getBlock(info2, start, numValues, values2);
+            dpiVector__accumulate(metric, values1, values2, numValues, sums);
+        }
+    } else {
+        dpiVector__getSparseSums(info1, info2, metric, sums);
+    }
+
+    // calculate distance from the sums
+    switch (metric) {
+        case DPI_VECTOR_DISTANCE_COSINE:
+            *distance = 1 - sums[0] / (sqrt(sums[1]) * sqrt(sums[2]));
+            break;
+        case DPI_VECTOR_DISTANCE_DOT:
+            *distance = -sums[0];
+            break;
+        case DPI_VECTOR_DISTANCE_EUCLIDEAN:
+            *distance = sqrt(sums[0]);
+            break;
+        default:
+            *distance = sums[0];
+            break;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVector__getSparseSums() [INTERNAL]
+//   Calculate the sums from which the distance is calculated when at least
+// one of the vectors is sparse. The indices of the two vectors are merged
+// (a dense vector is treated as having every index) and the pairs of values
+// are collected into blocks; an index found in only one of the vectors is
+// paired with zero.
+//-----------------------------------------------------------------------------
+static void dpiVector__getSparseSums(const dpiVectorInfo *info1,
+        const dpiVectorInfo *info2, dpiVectorDistanceMetric metric,
+        double *sums)
+{
+    double values1[DPI_VECTOR_BLOCK_SIZE], values2[DPI_VECTOR_BLOCK_SIZE];
+    uint32_t pos1, pos2, count1, count2, index1, index2, numValues;
+
+    count1 = (info1->isSparse) ? info1->numSparseValues :
+            info1->numDimensions;
+    count2 = (info2->isSparse) ? info2->numSparseValues :
+            info2->numDimensions;
+    pos1 = pos2 = numValues = 0;
+    while (pos1 < count1 || pos2 < count2) {
+        index1 = (pos1 == count1) ? UINT_MAX :
+                (info1->isSparse) ? info1->sparseIndices[pos1] : pos1;
+        index2 = (pos2 == count2) ? UINT_MAX :
+                (info2->isSparse) ? info2->sparseIndices[pos2] : pos2;
+        values1[numValues] = values2[numValues] = 0;
+        if (index1 <= index2)
+            values1[numValues] = dpiVector__getDimension(info1, pos1++);
+        if (index2 <= index1)
+            values2[numValues] = dpiVector__getDimension(info2, pos2++);
+        if (++numValues == DPI_VECTOR_BLOCK_SIZE) {
+            dpiVector__accumulate(metric, values1, values2, numValues, sums);
+            numValues = 0;
+        }
+    }
+    dpiVector__accumulate(metric, values1, values2, numValues, sums);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVector__getValue() [INTERNAL]
 //   Gets information about the vector.
@@ -170,7 +471,8 @@ int dpiVector__getValue(dpiVector *vector, dpiVectorInfo *info,
             if (dpiOci__vectorToSparseArray(vector, error) < 0)
                 return DPI_FAILURE;
         } else {
-            if (dpiOci__vectorToArray(vector, error) < 0)
+            if (dpiOci__vectorToArray(vector, vector->format,
+                    &vector->numDimensions, vector->dimensions, error) < 0)
                 return DPI_FAILURE;
         }
 
@@ -188,6 +490,19 @@ int dpiVector__getValue(dpiVector *vector, dpiVectorInfo *info,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVector__popCount() [INTERNAL]
+//   Return the number of bits set in the value.
+//-----------------------------------------------------------------------------
+static uint32_t dpiVector__popCount(uint32_t value)
+{
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+    value = (value + (value >> 4)) & 0x0f0f0f0f;
+    return (value * 0x01010101) >> 24;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVector_addRef() [PUBLIC]
 //   Add a reference to the vector object.
@@ -198,6 +513,69 @@ int dpiVector_addRef(dpiVector *vector)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVector_getDistance() [PUBLIC]
+//   Return the distance between two vectors.
+//-----------------------------------------------------------------------------
+int dpiVector_getDistance(dpiVector *vector1, dpiVector *vector2,
+        dpiVectorDistanceMetric metric, double *distance)
+{
+    dpiVectorInfo info1, info2;
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(vector1, DPI_HTYPE_VECTOR, __func__,
+            &error) < 0)
+        return DPI_FAILURE;
+    if (dpiGen__checkHandle(vector2, DPI_HTYPE_VECTOR, "check vector",
+            &error) < 0)
+        return dpiGen__endPublicFn(vector1, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(vector1, distance)
+    status = dpiVector__getValue(vector1, &info1, &error);
+    if (status == DPI_SUCCESS)
+        status = dpiVector__getValue(vector2, &info2, &error);
+    if (status == DPI_SUCCESS)
+        status = dpiVector__getDistance(&info1, &info2, metric, distance,
+                &error);
+    return dpiGen__endPublicFn(vector1, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVector_getDistances() [PUBLIC]
+//   Return the distances between a vector and each of a number of vectors,
+// such as those fetched for a set of candidate rows. The information about
+// the first vector is only acquired once.
+//-----------------------------------------------------------------------------
+int dpiVector_getDistances(dpiVector *vector, uint32_t numVectors,
+        dpiVector **vectors, dpiVectorDistanceMetric metric,
+        double *distances)
+{
+    dpiVectorInfo info, otherInfo;
+    int status;
+    dpiError error;
+    uint32_t i;
+
+    if (dpiGen__startPublicFn(vector, DPI_HTYPE_VECTOR, __func__, &error) < 0)
+        return DPI_FAILURE;
+    if (numVectors > 0) {
+        DPI_CHECK_PTR_NOT_NULL(vector, vectors)
+        DPI_CHECK_PTR_NOT_NULL(vector, distances)
+    }
+    status = dpiVector__getValue(vector, &info, &error);
+    for (i = 0; i < numVectors && status == DPI_SUCCESS; i++) {
+        status = dpiGen__checkHandle(vectors[i], DPI_HTYPE_VECTOR,
+                "check vector", &error);
+        if (status == DPI_SUCCESS)
+            status = dpiVector__getValue(vectors[i], &otherInfo, &error);
+        if (status == DPI_SUCCESS)
+            status = dpiVector__getDistance(&info, &otherInfo, metric,
+                    &distances[i], &error);
+    }
+    return dpiGen__endPublicFn(vector, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVector_getValue() [PUBLIC]
 //   Returns information about the vector to the caller.
@@ -657,6 +657,26 @@ int dpiTestCase_setupRoundTripChecker(dpiTestCase *testCase,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTestCase_truncateTempTable() [PUBLIC]
+//   Truncates the table TestTempTable so that the test case starts with no
+// rows.
+//-----------------------------------------------------------------------------
+int dpiTestCase_truncateTempTable(dpiTestCase *testCase, dpiConn *conn)
+{
+    const char *sql = "truncate table TestTempTable";
+    dpiStmt *stmt;
+
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiTestCase_updateRoundTrips() [PUBLIC]
 //   Update the number of round trips associated with the connection used by
@@ -701,6 +721,43 @@ int dpiTestCase_updateRoundTrips(dpiTestCase *testCase)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTestCase_verifyTempTableTotals() [PUBLIC]
+//   Queries the number of rows in the table TestTempTable, the number of
+// non-null strings, the sum of the integers and the sum of the string lengths
+// and verifies that they match the expected values.
+//-----------------------------------------------------------------------------
+int dpiTestCase_verifyTempTableTotals(dpiTestCase *testCase, dpiConn *conn,
+        const uint64_t *expectedValues)
+{
+    const char *sql =
+            "select count(*), count(StringCol), sum(IntCol), "
+            "sum(length(StringCol)) from TestTempTable";
+    uint32_t numQueryColumns, bufferRowIndex, i;
+    dpiNativeTypeNum nativeTypeNum;
+    dpiData *data;
+    dpiStmt *stmt;
+    int found;
+
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, &numQueryColumns) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < numQueryColumns; i++) {
+        if (dpiStmt_getQueryValue(stmt, i + 1, &nativeTypeNum, &data) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTestCase_expectUintEqual(testCase,
+                (uint64_t) dpiData_getDouble(data), expectedValues[i]) < 0)
+            return DPI_FAILURE;
+    }
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiTestSuite_addCase() [PUBLIC]
 // Adds a test case to the test suite. Memory for the test cases is allocated
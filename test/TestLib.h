@@ -190,9 +190,16 @@ int dpiTestCase_setSkippedIfVersionTooOld(dpiTestCase *testCase,
 int dpiTestCase_setupRoundTripChecker(dpiTestCase *testCase,
         dpiTestParams *params);
 
+// truncate the table TestTempTable
+int dpiTestCase_truncateTempTable(dpiTestCase *testCase, dpiConn *conn);
+
 // update the number of round trips
 int dpiTestCase_updateRoundTrips(dpiTestCase *testCase);
 
+// verify the row count and totals of the table TestTempTable
+int dpiTestCase_verifyTempTableTotals(dpiTestCase *testCase, dpiConn *conn,
+        const uint64_t *expectedValues);
+
 // add test case to test suite
 void dpiTestSuite_addCase(dpiTestCaseFunction func, const char *description);
 
@@ -128,6 +128,9 @@ create type &main_user..udt_Object as object (
 create type &main_user..udt_Array as varray(10) of number;
 /
 
+create type &main_user..udt_NumberTable as table of number;
+/
+
 create type &main_user..udt_ObjectDataTypes as object (
     StringCol                           varchar2(60),
     UnicodeCol                          nvarchar2(60),
@@ -645,6 +648,9 @@ create or replace package &main_user..pkg_TestNumberArrays as
 
     type udt_NumberList is table of number index by binary_integer;
 
+    type udt_BinaryDoubleList is table of binary_double
+            index by binary_integer;
+
     function TestInArrays (
         a_StartingValue                 number,
         a_Array                         udt_NumberList
@@ -655,6 +661,11 @@ create or replace package &main_user..pkg_TestNumberArrays as
         a_Array                         in out nocopy udt_NumberList
     );
 
+    procedure TestInOutBinaryDoubleArrays (
+        a_NumElems                      number,
+        a_Array                         in out nocopy udt_BinaryDoubleList
+    );
+
     procedure TestOutArrays (
         a_NumElems                      number,
         a_Array                         out nocopy udt_NumberList
@@ -688,6 +699,16 @@ create or replace package body &main_user..pkg_TestNumberArrays as
         end loop;
     end;
 
+    procedure TestInOutBinaryDoubleArrays (
+        a_NumElems                      number,
+        a_Array                         in out udt_BinaryDoubleList
+    ) is
+    begin
+        for i in 1..a_NumElems loop
+            a_Array(i) := a_Array(i) * 10;
+        end loop;
+    end;
+
     procedure TestOutArrays (
         a_NumElems                      number,
         a_Array                         out udt_NumberList
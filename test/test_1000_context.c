@@ -202,6 +202,45 @@ int dpiTest_1007(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_1008()
+//   Create a context with minor version 0; call
+// dpiContext_initSubscrCreateParams() and verify that the members added in
+// version 6.1 are left untouched, since applications built for version 6.0 do
+// not include them in the structure (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1008(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiSubscrCreateParams createParams;
+    dpiErrorInfo errorInfo;
+    dpiContext *context;
+
+    if (dpiContext_createWithParams(DPI_MAJOR_VERSION, 0, NULL, &context,
+            &errorInfo) < 0)
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    memset(&createParams, 0xff, sizeof(createParams));
+    if (dpiContext_initSubscrCreateParams(context, &createParams) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+    if (dpiTestCase_expectUintEqual(testCase, createParams.clientInitiated,
+            0) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, createParams.maxQueuedMessages,
+            UINT32_MAX) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase,
+            createParams.coalesceRowThreshold, UINT32_MAX) < 0)
+        return DPI_FAILURE;
+    if (dpiContext_destroy(context) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -224,5 +263,7 @@ int main(int argc, char **argv)
             "dpiContext_createWithParams() with creation parameters");
     dpiTestSuite_addCase(dpiTest_1007,
             "dpiContext_createWithParams() twice");
+    dpiTestSuite_addCase(dpiTest_1008,
+            "dpiContext_initSubscrCreateParams() with minor version 0");
     return dpiTestSuite_run();
 }
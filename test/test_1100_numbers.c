@@ -29,6 +29,55 @@
 
 #include "TestLib.h"
 
+//-----------------------------------------------------------------------------
+// dpiTest__verifyNumberAsText() [INTERNAL]
+//   Bind the value (stored in a variable of the given native type), fetch it
+// back from the database as a string and verify it matches the expected
+// value.
+//-----------------------------------------------------------------------------
+int dpiTest__verifyNumberAsText(dpiTestCase *testCase, dpiConn *conn,
+        dpiNativeTypeNum nativeTypeNum, dpiDataBuffer *value,
+        const char *expectedValue)
+{
+    uint32_t numQueryColumns, bufferRowIndex;
+    const char *sql = "select :1 from dual";
+    dpiData *varData;
+    dpiStmt *stmt;
+    dpiVar *var;
+    int found;
+
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, nativeTypeNum, 1, 0, 0,
+            0, NULL, &var, &varData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    varData->isNull = 0;
+    varData->value = *value;
+    if (dpiStmt_bindByPos(stmt, 1, var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, &numQueryColumns) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_BYTES,
+            1, 0, 0, 0, NULL, &var, &varData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_define(stmt, 1, var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectStringEqual(testCase, varData->value.asBytes.ptr,
+            varData->value.asBytes.length, expectedValue,
+            strlen(expectedValue)) < 0)
+        return DPI_FAILURE;
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiTest_1100()
 //   Verify that a large unsigned integer (larger than can be represented by
@@ -343,6 +392,63 @@ int dpiTest_1105(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_1106()
+//   Verify that integers (including the smallest and largest values that can
+// be represented) are transferred to Oracle and returned from Oracle
+// successfully.
+//-----------------------------------------------------------------------------
+int dpiTest_1106(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const int64_t values[] = { 0, 7, -7, 1200, -1200, 100000000000000000,
+            INT64_MAX, INT64_MIN };
+    const char *expectedValues[] = { "0", "7", "-7", "1200", "-1200",
+            "100000000000000000", "9223372036854775807",
+            "-9223372036854775808" };
+    dpiDataBuffer value;
+    dpiConn *conn;
+    uint32_t i;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        value.asInt64 = values[i];
+        if (dpiTest__verifyNumberAsText(testCase, conn, DPI_NATIVE_TYPE_INT64,
+                &value, expectedValues[i]) < 0)
+            return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1107()
+//   Verify that doubles are transferred to Oracle using the shortest number
+// of digits that represents the double exactly.
+//-----------------------------------------------------------------------------
+int dpiTest_1107(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const double values[] = { 0.1, -0.1, 1.0 / 3.0, 123456.789, 1e21,
+            0.1 + 0.2, -2.5e-10 };
+    const char *expectedValues[] = { "0.1", "-0.1",
+            "0.3333333333333333", "123456.789", "1000000000000000000000",
+            "0.30000000000000004", "-0.00000000025" };
+    dpiDataBuffer value;
+    dpiConn *conn;
+    uint32_t i;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        value.asDouble = values[i];
+        if (dpiTest__verifyNumberAsText(testCase, conn,
+                DPI_NATIVE_TYPE_DOUBLE, &value, expectedValues[i]) < 0)
+            return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -361,6 +467,10 @@ int main(int argc, char **argv)
             "bind zero as a string value with trailing zeroes");
     dpiTestSuite_addCase(dpiTest_1105,
             "bind numbers as strings and verify round trip");
+    dpiTestSuite_addCase(dpiTest_1106,
+            "bind integers and verify round trip");
+    dpiTestSuite_addCase(dpiTest_1107,
+            "bind doubles and verify shortest digits are used");
 
     return dpiTestSuite_run();
 }
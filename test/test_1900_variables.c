@@ -868,6 +868,97 @@ int dpiTest_1929(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_1930()
+//   Create a variable that uses native type DPI_NATIVE_TYPE_INT64; call
+// dpiVar_setFromColumn() with a number of values that extends beyond the
+// value for maxArraySize used when the variable was created (error DPI-1009).
+//-----------------------------------------------------------------------------
+int dpiTest_1930(dpiTestCase *testCase, dpiTestParams *params)
+{
+    int64_t values[MAX_ARRAY_SIZE] = { 1, 2, 3 };
+    dpiConn *conn;
+    dpiData *data;
+    dpiVar *var;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64,
+            MAX_ARRAY_SIZE, 0, 0, 0, NULL, &var, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiVar_setFromColumn(var, 1, MAX_ARRAY_SIZE, values, NULL, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1009:") < 0)
+        return DPI_FAILURE;
+    dpiVar_setFromColumn(NULL, 0, MAX_ARRAY_SIZE, values, NULL, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1002:") < 0)
+        return DPI_FAILURE;
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1931()
+//   Create variables that use native types DPI_NATIVE_TYPE_INT64 and
+// DPI_NATIVE_TYPE_BYTES; call dpiVar_setFromColumn() with columns of values,
+// offsets and a null bitmap, then call dpiStmt_executeMany() and verify that
+// the rows inserted match expectations (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1931(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql = "insert into TestTempTable values (:1, :2)";
+    uint32_t offsets[MAX_ARRAY_SIZE + 1] = { 0, 3, 3, 8 };
+    int64_t intValues[MAX_ARRAY_SIZE] = { 10, 20, 30 };
+    uint64_t expectedValues[4] = { 3, 2, 60, 8 };
+    const char *strValues = "onethree";
+    uint8_t nullBitmap = 0x05;
+    dpiVar *intVar, *strVar;
+    dpiData *data;
+    dpiConn *conn;
+    dpiStmt *stmt;
+
+    // truncate table
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_truncateTempTable(testCase, conn) < 0)
+        return DPI_FAILURE;
+
+    // bind columns of values and insert them
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64,
+            MAX_ARRAY_SIZE, 0, 0, 0, NULL, &intVar, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_VARCHAR, DPI_NATIVE_TYPE_BYTES,
+            MAX_ARRAY_SIZE, 100, 1, 0, NULL, &strVar, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_setFromColumn(intVar, 0, MAX_ARRAY_SIZE, intValues, NULL,
+            NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_setFromColumn(strVar, 0, MAX_ARRAY_SIZE, strValues, offsets,
+            &nullBitmap) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 2, strVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_executeMany(stmt, DPI_MODE_EXEC_DEFAULT, MAX_ARRAY_SIZE) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(strVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // verify the rows that were inserted
+    return dpiTestCase_verifyTempTableTotals(testCase, conn, expectedValues);
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -936,5 +1027,9 @@ int main(int argc, char **argv)
             "dpiVar_setFromJson() with valid arguments");
     dpiTestSuite_addCase(dpiTest_1929,
             "verify dpiVar_setFromJson() with NULL");
+    dpiTestSuite_addCase(dpiTest_1930,
+            "dpiVar_setFromColumn() with position too large");
+    dpiTestSuite_addCase(dpiTest_1931,
+            "dpiVar_setFromColumn() with int64 and string columns");
     return dpiTestSuite_run();
 }
@@ -60,6 +60,9 @@ int dpiTest__callFunctionsWithError(dpiTestCase *testCase, dpiStmt *stmt,
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiStmt_executeMany(stmt, DPI_MODE_EXEC_DEFAULT, 0);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiStmt_executeManyFromArrow(stmt, DPI_MODE_EXEC_DEFAULT, NULL, NULL, 0);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiStmt_fetch(stmt, NULL, NULL);
@@ -203,6 +206,18 @@ int dpiTest__getRoundTripCnt(dpiTestCase *testCase, dpiTestParams *params,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest__releaseArrowArray() [INTERNAL]
+//   Release callback for the Arrow arrays used by the test cases. The arrays
+// are not dynamically allocated so all that is needed is to mark them as
+// released.
+//-----------------------------------------------------------------------------
+void dpiTest__releaseArrowArray(struct ArrowArray *array)
+{
+    array->release = NULL;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiTest__verifyBindCount() [INTERNAL]
 //   Determines the number of bind variables for the given statement and
@@ -1889,6 +1904,212 @@ int dpiTest_2036(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_2037()
+//   Prepare an insert statement with bind variables larger than required;
+// call dpiStmt_executeMany() for fewer iterations than the size of the
+// variables, delete all but the first row, then change only the first value
+// and call it again; verify that the rows inserted match expectations (no
+// error).
+//-----------------------------------------------------------------------------
+int dpiTest_2037(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql = "insert into TestTempTable values (:1, :2)";
+    const char *deleteSql = "delete from TestTempTable where IntCol > 1";
+    uint64_t expectedValues[4] = { 4, 4, 106, 32 };
+    uint32_t maxRows = 10, numIters = 3, i, numQueryColumns;
+    dpiData *intData, *strData;
+    dpiStmt *stmt, *deleteStmt;
+    dpiVar *intVar, *strVar;
+    dpiConn *conn;
+
+    // truncate table
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_truncateTempTable(testCase, conn) < 0)
+        return DPI_FAILURE;
+
+    // prepare and bind insert statement
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64,
+            maxRows, 0, 0, 0, NULL, &intVar, &intData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_VARCHAR, DPI_NATIVE_TYPE_BYTES,
+            maxRows, 100, 1, 0, NULL, &strVar, &strData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 2, strVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // insert rows, change one value and insert the rows again
+    for (i = 0; i < numIters; i++) {
+        intData[i].isNull = 0;
+        intData[i].value.asInt64 = i + 1;
+        if (dpiVar_setFromBytes(strVar, i, "Constant", 8) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiStmt_executeMany(stmt, DPI_MODE_EXEC_DEFAULT, numIters) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_prepareStmt(conn, 0, deleteSql, strlen(deleteSql), NULL, 0,
+            &deleteStmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(deleteStmt, DPI_MODE_EXEC_DEFAULT,
+            &numQueryColumns) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(deleteStmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    intData[0].value.asInt64 = 100;
+    if (dpiStmt_executeMany(stmt, DPI_MODE_EXEC_DEFAULT, numIters) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(strVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // verify the rows that were inserted
+    return dpiTestCase_verifyTempTableTotals(testCase, conn, expectedValues);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2038()
+//   Prepare an insert statement; create an Arrow struct array with an int64
+// column and a string column containing a null value; call
+// dpiStmt_executeManyFromArrow() with a batch size smaller than the number of
+// rows and verify that the rows inserted match expectations (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2038(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql = "insert into TestTempTable values (:1, :2)";
+    struct ArrowSchema intSchema, strSchema, schema, *childSchemas[2];
+    struct ArrowArray intArray, strArray, array, *childArrays[2];
+    const void *intBuffers[2], *strBuffers[3], *structBuffers[1];
+    int64_t intValues[5] = { 1, 2, 3, 4, 5 };
+    uint64_t expectedValues[4] = { 4, 3, 14, 7 };
+    int32_t offsets[6] = { 0, 1, 2, 4, 6, 9 };
+    uint8_t strValidity = 0x1d;
+    dpiConn *conn;
+    dpiStmt *stmt;
+
+    // populate the Arrow schemas; the struct array skips the first row
+    memset(&intSchema, 0, sizeof(intSchema));
+    intSchema.format = "l";
+    memset(&strSchema, 0, sizeof(strSchema));
+    strSchema.format = "u";
+    childSchemas[0] = &intSchema;
+    childSchemas[1] = &strSchema;
+    memset(&schema, 0, sizeof(schema));
+    schema.format = "+s";
+    schema.n_children = 2;
+    schema.children = childSchemas;
+
+    // populate the Arrow arrays
+    intBuffers[0] = NULL;
+    intBuffers[1] = intValues;
+    memset(&intArray, 0, sizeof(intArray));
+    intArray.length = 5;
+    intArray.n_buffers = 2;
+    intArray.buffers = intBuffers;
+    intArray.release = dpiTest__releaseArrowArray;
+    strBuffers[0] = &strValidity;
+    strBuffers[1] = offsets;
+    strBuffers[2] = "abccddeee";
+    memset(&strArray, 0, sizeof(strArray));
+    strArray.length = 5;
+    strArray.null_count = 1;
+    strArray.n_buffers = 3;
+    strArray.buffers = strBuffers;
+    strArray.release = dpiTest__releaseArrowArray;
+    childArrays[0] = &intArray;
+    childArrays[1] = &strArray;
+    structBuffers[0] = NULL;
+    memset(&array, 0, sizeof(array));
+    array.length = 4;
+    array.offset = 1;
+    array.n_buffers = 1;
+    array.n_children = 2;
+    array.buffers = structBuffers;
+    array.children = childArrays;
+    array.release = dpiTest__releaseArrowArray;
+
+    // truncate table
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_truncateTempTable(testCase, conn) < 0)
+        return DPI_FAILURE;
+
+    // insert the rows of the struct array in batches
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_executeManyFromArrow(stmt, DPI_MODE_EXEC_DEFAULT, &schema,
+            &array, 3) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // verify the rows that were inserted
+    return dpiTestCase_verifyTempTableTotals(testCase, conn, expectedValues);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2039()
+//   Prepare an insert statement; call dpiStmt_executeManyFromArrow() with an
+// Arrow struct array containing a column with an unsupported format (error
+// DPI-1097).
+//-----------------------------------------------------------------------------
+int dpiTest_2039(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql = "insert into TestTempTable values (:1, :2)";
+    struct ArrowSchema childSchema, schema, *childSchemas[1];
+    struct ArrowArray childArray, array, *childArrays[1];
+    const void *buffers[2] = { NULL, NULL };
+    dpiConn *conn;
+    dpiStmt *stmt;
+
+    memset(&childSchema, 0, sizeof(childSchema));
+    childSchema.format = "d:10,2";
+    childSchemas[0] = &childSchema;
+    memset(&schema, 0, sizeof(schema));
+    schema.format = "+s";
+    schema.n_children = 1;
+    schema.children = childSchemas;
+    memset(&childArray, 0, sizeof(childArray));
+    childArray.length = 1;
+    childArray.n_buffers = 2;
+    childArray.buffers = buffers;
+    childArray.release = dpiTest__releaseArrowArray;
+    childArrays[0] = &childArray;
+    memset(&array, 0, sizeof(array));
+    array.length = 1;
+    array.n_buffers = 1;
+    array.n_children = 1;
+    array.buffers = buffers;
+    array.children = childArrays;
+    array.release = dpiTest__releaseArrowArray;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_executeManyFromArrow(stmt, DPI_MODE_EXEC_DEFAULT, &schema, &array,
+            0);
+    if (dpiTestCase_expectError(testCase, "DPI-1097:") < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -1969,5 +2190,11 @@ int main(int argc, char **argv)
             "dpiStmt_executeMany() with PL/SQL statement row count");
     dpiTestSuite_addCase(dpiTest_2036,
             "verify round trips for prefetch values");
+    dpiTestSuite_addCase(dpiTest_2037,
+            "dpiStmt_executeMany() with fewer iterations than array size");
+    dpiTestSuite_addCase(dpiTest_2038,
+            "dpiStmt_executeManyFromArrow() with int64 and string columns");
+    dpiTestSuite_addCase(dpiTest_2039,
+            "dpiStmt_executeManyFromArrow() with unsupported format");
     return dpiTestSuite_run();
 }
@@ -1731,6 +1731,88 @@ int dpiTest_2108(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_2109()
+//   Insert LONG values of varying sizes, some of which require multiple pieces
+// to fetch; fetch them and verify that each value matches the value that was
+// inserted (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2109(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *selectSql = "select IntCol, LongCol from TestLongs "
+            "order by IntCol";
+    const char *insertSql = "insert into TestLongs values (:1, :2)";
+    const char *truncateSql = "truncate table TestLongs";
+    uint32_t sizes[5] = { 100, 200000, 150000, 500000, 70000 };
+    uint32_t i, numQueryColumns, bufferRowIndex;
+    dpiNativeTypeNum nativeTypeNum;
+    dpiData data, *longValue;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    char *buffer;
+    int found;
+
+    // populate buffer with data
+    buffer = malloc(sizes[3]);
+    if (!buffer)
+        return dpiTestCase_setFailed(testCase, "Out of memory!");
+    for (i = 0; i < sizes[3]; i++)
+        buffer[i] = 'A' + (i % 26);
+
+    // truncate table
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, truncateSql, strlen(truncateSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // insert rows of varying sizes
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < 5; i++) {
+        dpiData_setInt64(&data, i + 1);
+        if (dpiStmt_bindValueByPos(stmt, 1, DPI_NATIVE_TYPE_INT64, &data) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        dpiData_setBytes(&data, buffer, sizes[i]);
+        if (dpiStmt_bindValueByPos(stmt, 2, DPI_NATIVE_TYPE_BYTES, &data) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiStmt_execute(stmt, 0, NULL) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // fetch rows and verify the values
+    if (dpiConn_prepareStmt(conn, 0, selectSql, strlen(selectSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_setFetchArraySize(stmt, 2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, &numQueryColumns) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < 5; i++) {
+        if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiStmt_getQueryValue(stmt, 2, &nativeTypeNum, &longValue) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTestCase_expectStringEqual(testCase,
+                longValue->value.asBytes.ptr, longValue->value.asBytes.length,
+                buffer, sizes[i]) < 0)
+            return DPI_FAILURE;
+    }
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    free(buffer);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -1755,5 +1837,7 @@ int main(int argc, char **argv)
             "test conversion of string to number for invalid values");
     dpiTestSuite_addCase(dpiTest_2108,
             "verify collection containing dates works as expected");
+    dpiTestSuite_addCase(dpiTest_2109,
+            "verify LONG values of varying sizes are fetched correctly");
     return dpiTestSuite_run();
 }
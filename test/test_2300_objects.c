@@ -320,6 +320,7 @@ int dpiTest_2301(dpiTestCase *testCase, dpiTestParams *params)
     const char *expectedError = "DPI-1002:";
     dpiNativeTypeNum nativeTypeNum = DPI_NATIVE_TYPE_INT64;
     int32_t index, prevIndex, nextIndex, size;
+    uint32_t numElements;
     dpiConn *conn;
     dpiObject *obj;
     dpiData data;
@@ -332,6 +333,9 @@ int dpiTest_2301(dpiTestCase *testCase, dpiTestParams *params)
         return DPI_FAILURE;
     dpiData_setInt64(&data, 1);
     dpiObject_appendElement(NULL, nativeTypeNum, &data);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiObject_appendElements(NULL, nativeTypeNum, 1, &data);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiObject_copy(NULL, &obj);
@@ -341,12 +345,20 @@ int dpiTest_2301(dpiTestCase *testCase, dpiTestParams *params)
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiObject_getAttributeValue(NULL, NULL, nativeTypeNum, &data);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiObject_getAttributeValues(NULL, 0, NULL, NULL, &data);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiObject_getElementExistsByIndex(NULL, 1, &exists);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiObject_getElementValueByIndex(NULL, 1, nativeTypeNum, &data);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    numElements = 1;
+    dpiObject_getElementValues(NULL, nativeTypeNum, &numElements, NULL,
+            &data);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiObject_getFirstIndex(NULL, &index, &exists);
@@ -2224,6 +2236,218 @@ int dpiTest_2340(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_2341()
+//   Create an object of type UDT_NUMBERTABLE; call dpiObject_appendElements()
+// with a number of values; call dpiObject_getElementValues() with an array
+// that is too small (error DPI-1018); delete an element and call
+// dpiObject_getElementValues() again; verify that the remaining elements and
+// their indices are returned as expected. A nested table is used since
+// elements cannot be deleted from a VARRAY (error OCI-22164).
+//-----------------------------------------------------------------------------
+int dpiTest_2341(dpiTestCase *testCase, dpiTestParams *params)
+{
+    int32_t indices[5], expectedIndices[4] = { 0, 2, 3, 4 };
+    int64_t values[5] = { 5, -17, 0, 1234567, 98 };
+    const char *objName = "UDT_NUMBERTABLE";
+    dpiObjectType *objType;
+    uint32_t numElements;
+    dpiData data[5];
+    dpiObject *obj;
+    dpiConn *conn;
+    int32_t size;
+    uint32_t i;
+
+    // create collection and append all of the values at once
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_getObjectType(conn, objName, strlen(objName), &objType) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiObjectType_createObject(objType, &obj) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < 5; i++)
+        dpiData_setInt64(&data[i], values[i]);
+    if (dpiObject_appendElements(obj, DPI_NATIVE_TYPE_INT64, 5, data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiObject_getSize(obj, &size) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, size, 5) < 0)
+        return DPI_FAILURE;
+
+    // an array that is too small should be rejected
+    numElements = 3;
+    dpiObject_getElementValues(obj, DPI_NATIVE_TYPE_INT64, &numElements,
+            NULL, data);
+    if (dpiTestCase_expectError(testCase, "DPI-1018:") < 0)
+        return DPI_FAILURE;
+
+    // get all of the values at once
+    numElements = 5;
+    if (dpiObject_getElementValues(obj, DPI_NATIVE_TYPE_INT64, &numElements,
+            indices, data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numElements, 5) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < numElements; i++) {
+        if (dpiTestCase_expectIntEqual(testCase, indices[i], i) < 0)
+            return DPI_FAILURE;
+        if (dpiTestCase_expectIntEqual(testCase, data[i].value.asInt64,
+                values[i]) < 0)
+            return DPI_FAILURE;
+    }
+
+    // deleted elements should be skipped
+    if (dpiObject_deleteElementByIndex(obj, 1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    numElements = 5;
+    if (dpiObject_getElementValues(obj, DPI_NATIVE_TYPE_INT64, &numElements,
+            indices, data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numElements, 4) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < numElements; i++) {
+        if (dpiTestCase_expectIntEqual(testCase, indices[i],
+                expectedIndices[i]) < 0)
+            return DPI_FAILURE;
+        if (dpiTestCase_expectIntEqual(testCase, data[i].value.asInt64,
+                values[expectedIndices[i]]) < 0)
+            return DPI_FAILURE;
+    }
+
+    // cleanup
+    if (dpiObject_release(obj) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiObjectType_release(objType) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2342()
+//   Create an object of type UDT_SUBOBJECT and set its attributes; call
+// dpiObject_getAttributeValues() for all of the attributes; verify that the
+// values are returned as expected.
+//-----------------------------------------------------------------------------
+int dpiTest_2342(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiNativeTypeNum nativeTypeNums[2] = {
+        DPI_NATIVE_TYPE_INT64, DPI_NATIVE_TYPE_BYTES
+    };
+    const char *objName = "UDT_SUBOBJECT", *str = "bulk attributes";
+    dpiObjectType *objType;
+    dpiObjectAttr *attrs[2];
+    dpiData data[2];
+    dpiObject *obj;
+    dpiConn *conn;
+    int i;
+
+    // create object and populate its attributes
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_getObjectType(conn, objName, strlen(objName), &objType) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiObjectType_getAttributes(objType, 2, attrs) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiObjectType_createObject(objType, &obj) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiData_setInt64(&data[0], 2342);
+    if (dpiObject_setAttributeValue(obj, attrs[0], DPI_NATIVE_TYPE_INT64,
+            &data[0]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiData_setBytes(&data[1], (char*) str, strlen(str));
+    if (dpiObject_setAttributeValue(obj, attrs[1], DPI_NATIVE_TYPE_BYTES,
+            &data[1]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // get all of the attributes at once
+    if (dpiObject_getAttributeValues(obj, 2, attrs, nativeTypeNums,
+            data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectIntEqual(testCase, data[0].value.asInt64,
+            2342) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectStringEqual(testCase, data[1].value.asBytes.ptr,
+            data[1].value.asBytes.length, str, strlen(str)) < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    for (i = 0; i < 2; i++) {
+        if (dpiObjectAttr_release(attrs[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiObject_release(obj) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiObjectType_release(objType) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2343()
+//   Call PL/SQL procedure which populates a sparse index-by table with
+// negative and positive indices; call dpiObject_getElementValues() and verify
+// that all of the elements and their indices are returned (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2343(dpiTestCase *testCase, dpiTestParams *params)
+{
+    int32_t indices[5], expectedIndices[4] = { -1048576, -576, 284, 8388608 };
+    const char *stringData[4] = { "First element", "Second element",
+            "Third element", "Fourth element" };
+    uint32_t numQueryColumns, numElements, i;
+    dpiObjectType *objType;
+    dpiData *objectValue;
+    dpiVar *objectVar;
+    dpiData data[5];
+    dpiStmt *stmt;
+    dpiConn *conn;
+
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 12, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_getObjectType(conn, TYPE_NAME, strlen(TYPE_NAME),
+            &objType) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_OBJECT, DPI_NATIVE_TYPE_OBJECT, 1,
+            0, 0, 0, objType, &objectVar, &objectValue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_prepareStmt(conn, 0, SQL_TEXT, strlen(SQL_TEXT), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, objectVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, &numQueryColumns) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    numElements = 5;
+    if (dpiObject_getElementValues(objectValue->value.asObject,
+            DPI_NATIVE_TYPE_BYTES, &numElements, indices, data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numElements, 4) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < numElements; i++) {
+        if (dpiTestCase_expectIntEqual(testCase, indices[i],
+                expectedIndices[i]) < 0)
+            return DPI_FAILURE;
+        if (dpiTestCase_expectStringEqual(testCase, data[i].value.asBytes.ptr,
+                data[i].value.asBytes.length, stringData[i],
+                strlen(stringData[i])) < 0)
+            return DPI_FAILURE;
+    }
+    if (dpiVar_release(objectVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiObjectType_release(objType) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -2312,5 +2536,11 @@ int main(int argc, char **argv)
             "call dpiObjectType_createObject() with object type as NULL");
     dpiTestSuite_addCase(dpiTest_2340,
             "test inserts/fetches works with nested collections");
+    dpiTestSuite_addCase(dpiTest_2341,
+            "test appending and getting all collection elements at once");
+    dpiTestSuite_addCase(dpiTest_2342,
+            "test getting a number of attribute values at once");
+    dpiTestSuite_addCase(dpiTest_2343,
+            "test getting all elements of a sparse index-by table at once");
     return dpiTestSuite_run();
 }
@@ -277,6 +277,9 @@ int dpiTest_2803(dpiTestCase *testCase, dpiTestParams *params)
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiLob_getSize(lob, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiLob_newReader(lob, 1, 0, NULL);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiLob_openResource(lob);
@@ -1156,6 +1159,404 @@ int dpiTest_2828(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest__readAllWithReader() [INTERNAL]
+//   Read all of the pieces from the LOB reader into the supplied buffer and
+// return the total length read.
+//-----------------------------------------------------------------------------
+int dpiTest__readAllWithReader(dpiTestCase *testCase, dpiLobReader *reader,
+        char *buffer, uint64_t bufferSize, uint64_t *totalLength)
+{
+    uint64_t valueLength;
+    const char *value;
+
+    *totalLength = 0;
+    while (1) {
+        if (dpiLobReader_read(reader, &value, &valueLength) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (valueLength == 0)
+            break;
+        if (*totalLength + valueLength > bufferSize)
+            return dpiTestCase_setFailed(testCase, "too much data read");
+        memcpy(buffer + *totalLength, value, valueLength);
+        *totalLength += valueLength;
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2829()
+//   Stream a BLOB larger than a single piece with a LOB reader and verify
+// that the data read matches what was written (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2829(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const uint32_t lobSize = 300000;
+    char *readBuffer, *writeBuffer;
+    uint64_t totalLength;
+    dpiLobReader *reader;
+    dpiConn *conn;
+    dpiLob *lob;
+    uint32_t i;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    writeBuffer = malloc(lobSize);
+    readBuffer = malloc(lobSize);
+    if (!writeBuffer || !readBuffer)
+        return dpiTestCase_setFailed(testCase, "Out of memory!");
+    for (i = 0; i < lobSize; i++)
+        writeBuffer[i] = (char) (i % 251);
+    if (dpiTest__populateAndGetLobFromTable(testCase, conn,
+            DPI_ORACLE_TYPE_BLOB, writeBuffer, lobSize, &lob) < 0)
+        return DPI_FAILURE;
+    if (dpiLob_newReader(lob, 1, 0, &reader) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__readAllWithReader(testCase, reader, readBuffer, lobSize,
+            &totalLength) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, totalLength, lobSize) < 0)
+        return DPI_FAILURE;
+    if (memcmp(readBuffer, writeBuffer, lobSize) != 0)
+        return dpiTestCase_setFailed(testCase, "data read does not match");
+    if (dpiTest__readAllWithReader(testCase, reader, readBuffer, lobSize,
+            &totalLength) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, totalLength, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiLobReader_release(reader) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLob_release(lob) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    free(readBuffer);
+    free(writeBuffer);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2830()
+//   Stream a portion of a CLOB with a LOB reader using an offset and amount
+// and verify that the data read matches (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2830(dpiTestCase *testCase, dpiTestParams *params)
+{
+    uint64_t totalLength;
+    dpiLobReader *reader;
+    char readBuffer[100];
+    dpiConn *conn;
+    dpiLob *lob;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__populateAndGetLobFromTable(testCase, conn,
+            DPI_ORACLE_TYPE_CLOB, NULL, 0, &lob) < 0)
+        return DPI_FAILURE;
+    if (dpiLob_newReader(lob, 3, 3, &reader) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__readAllWithReader(testCase, reader, readBuffer,
+            sizeof(readBuffer), &totalLength) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectStringEqual(testCase, readBuffer, totalLength,
+            DEFAULT_CHARS + 2, 3) < 0)
+        return DPI_FAILURE;
+    if (dpiLobReader_release(reader) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLob_release(lob) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2831()
+//   Close a LOB reader before all of the data has been read and verify that
+// the connection can be used again and that the reader cannot be used after
+// it has been closed (error DPI-1091).
+//-----------------------------------------------------------------------------
+int dpiTest_2831(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const uint32_t lobSize = 300000;
+    dpiLobReader *reader;
+    uint64_t valueLength;
+    const char *value;
+    char *writeBuffer;
+    uint64_t size;
+    dpiConn *conn;
+    dpiLob *lob;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    writeBuffer = malloc(lobSize);
+    if (!writeBuffer)
+        return dpiTestCase_setFailed(testCase, "Out of memory!");
+    memset(writeBuffer, 'X', lobSize);
+    if (dpiTest__populateAndGetLobFromTable(testCase, conn,
+            DPI_ORACLE_TYPE_BLOB, writeBuffer, lobSize, &lob) < 0)
+        return DPI_FAILURE;
+    if (dpiLob_newReader(lob, 1, 0, &reader) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLobReader_read(reader, &value, &valueLength) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLobReader_close(reader) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiLobReader_read(reader, &value, &valueLength);
+    if (dpiTestCase_expectError(testCase, "DPI-1091:") < 0)
+        return DPI_FAILURE;
+    if (dpiLob_getSize(lob, &size) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, size, lobSize) < 0)
+        return DPI_FAILURE;
+    if (dpiLobReader_release(reader) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLob_release(lob) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    free(writeBuffer);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2832()
+//   Fetch a small CLOB as bytes and verify that the LOB data is prefetched so
+// that no round trips are required beyond the execute and fetch (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2832(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select CLOBCol from TestCLOBs";
+    dpiNativeTypeNum nativeTypeNum;
+    uint32_t bufferRowIndex;
+    dpiData *data;
+    dpiStmt *stmt;
+    dpiConn *conn;
+    dpiLob *lob;
+    int found;
+
+    // populate table with a small CLOB
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__populateAndGetLobFromTable(testCase, conn,
+            DPI_ORACLE_TYPE_CLOB, NULL, 0, &lob) < 0)
+        return DPI_FAILURE;
+    if (dpiLob_release(lob) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // fetch the CLOB as bytes; prefetch of rows is disabled so that the row
+    // is fetched after the define has been performed
+    if (dpiTestCase_setupRoundTripChecker(testCase, params) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_setPrefetchRows(stmt, 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_defineValue(stmt, 1, DPI_ORACLE_TYPE_CLOB,
+            DPI_NATIVE_TYPE_BYTES, 0, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_getQueryValue(stmt, 1, &nativeTypeNum, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectStringEqual(testCase, data->value.asBytes.ptr,
+            data->value.asBytes.length, DEFAULT_CHARS,
+            strlen(DEFAULT_CHARS)) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectRoundTripsEqual(testCase, 2) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2833()
+//   Copy a BLOB fetched on one pooled connection to a second connection
+// acquired from the same pool and verify that the data read using the second
+// connection matches what was written (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2833(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const uint32_t lobSize = 100000;
+    char *readBuffer, *writeBuffer;
+    dpiLob *lob, *copiedLob;
+    dpiConn *conn1, *conn2;
+    uint64_t totalLength;
+    dpiLobReader *reader;
+    dpiPool *pool;
+    uint32_t i;
+
+    if (dpiTestCase_getPool(testCase, &pool) < 0)
+        return DPI_FAILURE;
+    if (dpiPool_acquireConnection(pool, NULL, 0, NULL, 0, NULL, &conn1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiPool_acquireConnection(pool, NULL, 0, NULL, 0, NULL, &conn2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    writeBuffer = malloc(lobSize);
+    readBuffer = malloc(lobSize);
+    if (!writeBuffer || !readBuffer)
+        return dpiTestCase_setFailed(testCase, "Out of memory!");
+    for (i = 0; i < lobSize; i++)
+        writeBuffer[i] = (char) (i % 241);
+    if (dpiTest__populateAndGetLobFromTable(testCase, conn1,
+            DPI_ORACLE_TYPE_BLOB, writeBuffer, lobSize, &lob) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_commit(conn1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLob_copyToConn(lob, conn2, &copiedLob) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLob_newReader(copiedLob, 1, 0, &reader) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__readAllWithReader(testCase, reader, readBuffer, lobSize,
+            &totalLength) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, totalLength, lobSize) < 0)
+        return DPI_FAILURE;
+    if (memcmp(readBuffer, writeBuffer, lobSize) != 0)
+        return dpiTestCase_setFailed(testCase, "data read does not match");
+    if (dpiLobReader_release(reader) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLob_release(copiedLob) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLob_release(lob) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_release(conn2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_release(conn1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiPool_release(pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    free(readBuffer);
+    free(writeBuffer);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2834()
+//   Attempt to copy a temporary LOB to a different connection (error
+// DPI-1093) and a persistent LOB to a connection that was not acquired from
+// the same pool (error DPI-1092).
+//-----------------------------------------------------------------------------
+int dpiTest_2834(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiLob *lob, *copiedLob;
+    dpiConn *conn1, *conn2;
+    dpiPool *pool;
+
+    if (dpiTestCase_getPool(testCase, &pool) < 0)
+        return DPI_FAILURE;
+    if (dpiPool_acquireConnection(pool, NULL, 0, NULL, 0, NULL, &conn1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiPool_acquireConnection(pool, NULL, 0, NULL, 0, NULL, &conn2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newTempLob(conn1, DPI_ORACLE_TYPE_CLOB, &lob) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiLob_copyToConn(lob, conn2, &copiedLob);
+    if (dpiTestCase_expectError(testCase, "DPI-1093:") < 0)
+        return DPI_FAILURE;
+    if (dpiLob_release(lob) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_release(conn2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__populateAndGetLobFromTable(testCase, conn1,
+            DPI_ORACLE_TYPE_CLOB, NULL, 0, &lob) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn2) < 0)
+        return DPI_FAILURE;
+    dpiLob_copyToConn(lob, conn2, &copiedLob);
+    if (dpiTestCase_expectError(testCase, "DPI-1092:") < 0)
+        return DPI_FAILURE;
+    if (dpiLob_release(lob) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_release(conn1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiPool_release(pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2835()
+//   Read the first piece of a BLOB larger than a single piece with a LOB
+// reader and then stream the remaining pieces to a temporary file with
+// dpiLobReader_readToFd(); verify that the number of bytes written and the
+// contents of the file match the remainder of the data written (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2835(dpiTestCase *testCase, dpiTestParams *params)
+{
+    uint64_t valueLength, numBytesWritten;
+    const uint32_t lobSize = 300000;
+    char *readBuffer, *writeBuffer;
+    dpiLobReader *reader;
+    const char *value;
+    dpiConn *conn;
+    dpiLob *lob;
+    uint32_t i;
+    FILE *fp;
+
+    // populate a BLOB and read the first piece
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    writeBuffer = malloc(lobSize);
+    readBuffer = malloc(lobSize);
+    if (!writeBuffer || !readBuffer)
+        return dpiTestCase_setFailed(testCase, "Out of memory!");
+    for (i = 0; i < lobSize; i++)
+        writeBuffer[i] = (char) (i % 241);
+    if (dpiTest__populateAndGetLobFromTable(testCase, conn,
+            DPI_ORACLE_TYPE_BLOB, writeBuffer, lobSize, &lob) < 0)
+        return DPI_FAILURE;
+    if (dpiLob_newReader(lob, 1, 0, &reader) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLobReader_read(reader, &value, &valueLength) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (valueLength == 0 || valueLength >= lobSize)
+        return dpiTestCase_setFailed(testCase, "unexpected first piece size");
+
+    // stream the remaining pieces to a temporary file
+    fp = tmpfile();
+    if (!fp)
+        return dpiTestCase_setFailed(testCase, "cannot create temporary file");
+    if (dpiLobReader_readToFd(reader, fileno(fp), &numBytesWritten) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numBytesWritten,
+            lobSize - valueLength) < 0)
+        return DPI_FAILURE;
+
+    // verify the contents of the file
+    if (fseek(fp, 0, SEEK_SET) != 0)
+        return dpiTestCase_setFailed(testCase, "cannot rewind temporary file");
+    if (dpiTestCase_expectUintEqual(testCase,
+            fread(readBuffer, 1, lobSize, fp), numBytesWritten) < 0)
+        return DPI_FAILURE;
+    if (memcmp(readBuffer, writeBuffer + valueLength,
+            (size_t) numBytesWritten) != 0)
+        return dpiTestCase_setFailed(testCase, "data written does not match");
+
+    // cleanup
+    fclose(fp);
+    if (dpiLobReader_release(reader) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLob_release(lob) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    free(readBuffer);
+    free(writeBuffer);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -1221,5 +1622,19 @@ int main(int argc, char **argv)
     dpiTestSuite_addCase(dpiTest_2828,
             "dpiLob_setFromBytes() with value not NULL and valueLength "
             "non-zero");
+    dpiTestSuite_addCase(dpiTest_2829,
+            "stream a BLOB with a LOB reader");
+    dpiTestSuite_addCase(dpiTest_2830,
+            "stream a portion of a CLOB with a LOB reader");
+    dpiTestSuite_addCase(dpiTest_2831,
+            "close a LOB reader before all data has been read");
+    dpiTestSuite_addCase(dpiTest_2832,
+            "fetch small CLOB as bytes without additional round trips");
+    dpiTestSuite_addCase(dpiTest_2833,
+            "copy LOB to another pooled connection and read it");
+    dpiTestSuite_addCase(dpiTest_2834,
+            "copy LOBs to connections which cannot use them");
+    dpiTestSuite_addCase(dpiTest_2835,
+            "stream remaining pieces of a BLOB to a file descriptor");
     return dpiTestSuite_run();
 }
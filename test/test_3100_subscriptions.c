@@ -73,6 +73,15 @@ int dpiTest_3101(dpiTestCase *testCase, dpiTestParams *params)
     const char *expectedError = "DPI-1002:";
 
     dpiSubscr_addRef(NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiSubscr_dequeueMessage(NULL, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiSubscr_freeMessage(NULL, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiSubscr_getNumDroppedMessages(NULL, NULL);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiSubscr_prepareStmt(NULL, NULL, 0, NULL);
@@ -86,6 +95,160 @@ int dpiTest_3101(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest__insertRows() [INTERNAL]
+//   Inserts the requested number of rows into the table TestTempTable,
+// committing after each row so that a separate notification is sent for each
+// of them.
+//-----------------------------------------------------------------------------
+int dpiTest__insertRows(dpiTestCase *testCase, dpiConn *conn,
+        uint32_t firstValue, uint32_t numRows)
+{
+    const char *sql = "insert into TestTempTable (IntCol) values (:1)";
+    dpiData intValue;
+    dpiStmt *stmt;
+    uint32_t i;
+
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < numRows; i++) {
+        dpiData_setInt64(&intValue, firstValue + i);
+        if (dpiStmt_bindValueByPos(stmt, 1, DPI_NATIVE_TYPE_INT64,
+                &intValue) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiStmt_execute(stmt, DPI_MODE_EXEC_COMMIT_ON_SUCCESS, NULL) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest__verifyMergedMessage() [INTERNAL]
+//   Waits for the notifications sent for the rows that were inserted to
+// arrive and verifies that they have been merged into a single queued message
+// with a single table reporting the expected number of rows (or all rows if
+// the expected number of rows is 0).
+//-----------------------------------------------------------------------------
+int dpiTest__verifyMergedMessage(dpiTestCase *testCase, dpiSubscr *subscr,
+        uint32_t expectedNumRows)
+{
+    dpiSubscrMessageTable *table;
+    dpiSubscrMessage *message;
+    uint64_t numDropped;
+
+    sleep(5);
+    if (dpiSubscr_dequeueMessage(subscr, &message) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (!message)
+        return dpiTestCase_setFailed(testCase, "no message was queued");
+    if (dpiTestCase_expectUintEqual(testCase, message->eventType,
+            DPI_EVENT_OBJCHANGE) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, message->numTables, 1) < 0)
+        return DPI_FAILURE;
+    table = &message->tables[0];
+    if (dpiTestCase_expectUintEqual(testCase,
+            (table->operation & DPI_OPCODE_INSERT) != 0, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase,
+            (table->operation & DPI_OPCODE_ALL_ROWS) != 0,
+            expectedNumRows == 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, table->numRows,
+            expectedNumRows) < 0)
+        return DPI_FAILURE;
+    if (dpiSubscr_freeMessage(subscr, message) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiSubscr_dequeueMessage(subscr, &message) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (message)
+        return dpiTestCase_setFailed(testCase, "unexpected queued message");
+    if (dpiSubscr_getNumDroppedMessages(subscr, &numDropped) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    return dpiTestCase_expectUintEqual(testCase, numDropped, 0);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_3102()
+//   Call dpiConn_subscribe() with protocol DPI_SUBSCR_PROTO_CALLBACK, no
+// callback, maxQueuedMessages set and the coalescing window and row threshold
+// set; register a query on TestTempTable and insert rows, committing after
+// each one; verify that the notifications are merged into a single queued
+// message reporting all of the rows; insert more rows than the row threshold
+// and verify that the merged message reports all rows instead (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_3102(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *querySql = "select IntCol from TestTempTable";
+    dpiCommonCreateParams commonParams;
+    dpiSubscrCreateParams subParams;
+    dpiContext *context;
+    dpiSubscr *subscr;
+    uint32_t numCols;
+    dpiStmt *stmt;
+    dpiConn *conn;
+
+    // create connection and empty the table
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initCommonCreateParams(context, &commonParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    commonParams.createMode = DPI_MODE_CREATE_EVENTS;
+    if (dpiConn_create(context, params->mainUserName,
+            params->mainUserNameLength, params->mainPassword,
+            params->mainPasswordLength, params->connectString,
+            params->connectStringLength, &commonParams, NULL, &conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_truncateTempTable(testCase, conn) < 0)
+        return DPI_FAILURE;
+
+    // create subscription with queued messages and coalescing
+    if (dpiContext_initSubscrCreateParams(context, &subParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (subParams.coalesceWindow != 0 || subParams.coalesceRowThreshold != 0)
+        return dpiTestCase_setFailed(testCase,
+                "coalescing should be disabled by default");
+    subParams.protocol = DPI_SUBSCR_PROTO_CALLBACK;
+    subParams.qos = DPI_SUBSCR_QOS_ROWIDS;
+    subParams.maxQueuedMessages = 10;
+    subParams.coalesceWindow = 30000;
+    subParams.coalesceRowThreshold = 4;
+    if (dpiConn_subscribe(conn, &subParams, &subscr) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // register the table with the subscription
+    if (dpiSubscr_prepareStmt(subscr, querySql, strlen(querySql), &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, &numCols) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // notifications for rows up to the threshold are merged with their rows
+    if (dpiTest__insertRows(testCase, conn, 1, 3) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__verifyMergedMessage(testCase, subscr, 3) < 0)
+        return DPI_FAILURE;
+
+    // notifications for rows beyond the threshold report all rows instead
+    if (dpiTest__insertRows(testCase, conn, 4, 5) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__verifyMergedMessage(testCase, subscr, 0) < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiConn_unsubscribe(conn, subscr) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiConn_release(conn);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -96,5 +259,7 @@ int main(int argc, char **argv)
             "dpiConn_subscribe() without callback");
     dpiTestSuite_addCase(dpiTest_3101,
             "call all dpiSubscr public functions with subscr param as NULL");
+    dpiTestSuite_addCase(dpiTest_3102,
+            "merge notifications queued by a subscription without callback");
     return dpiTestSuite_run();
 }
@@ -96,6 +96,22 @@ int dpiTest__countDocuments(dpiTestCase *testCase, dpiSodaColl *coll,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest__insertBatchCallback()
+//   Callback used for verifying the progress of batched inserts. The context
+// is an array of two counters: the number of batches inserted and the total
+// number of documents inserted.
+//-----------------------------------------------------------------------------
+void dpiTest__insertBatchCallback(void *context, uint32_t numDocs,
+        uint64_t totalNumDocs)
+{
+    uint64_t *counters = (uint64_t*) context;
+
+    counters[0]++;
+    counters[1] = totalNumDocs;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiTest__insertDoc()
 //   Create a document and insert it into the collection.
@@ -240,6 +256,9 @@ int dpiTest_3500(dpiTestCase *testCase, dpiTestParams *params)
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiSodaColl_findOne(NULL, NULL, DPI_SODA_FLAGS_DEFAULT, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiSodaColl_flushInsert(NULL);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiSodaColl_getDataGuide(NULL, DPI_SODA_FLAGS_DEFAULT, NULL);
@@ -258,6 +277,12 @@ int dpiTest_3500(dpiTestCase *testCase, dpiTestParams *params)
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiSodaColl_insertMany(NULL, 0, NULL, DPI_SODA_FLAGS_DEFAULT, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiSodaColl_insertBatched(NULL, NULL, 0, NULL, 0);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiSodaColl_insertJsonBatched(NULL, NULL, 0, NULL);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiSodaColl_release(NULL);
@@ -276,6 +301,10 @@ int dpiTest_3500(dpiTestCase *testCase, dpiTestParams *params)
     dpiSodaColl_save(NULL, NULL, DPI_SODA_FLAGS_DEFAULT, NULL);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
+    dpiSodaColl_setInsertBatching(NULL, 0, DPI_SODA_FLAGS_DEFAULT, NULL,
+            NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
 
     return DPI_SUCCESS;
 }
@@ -1442,6 +1471,151 @@ int dpiTest_3518(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_3519()
+//   Verify dpiSodaColl_insertBatched() works as expected. Add a set of
+// documents with a batch size that does not divide the number of documents
+// evenly and verify that full batches are inserted as they are filled, that
+// the remaining documents are inserted by dpiSodaColl_flushInsert() and that
+// the callback reports the progress of each batch.
+//-----------------------------------------------------------------------------
+int dpiTest_3519(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *collName = "ODPIC_COLL_2619";
+    uint32_t numDocs = 8, i;
+    uint64_t counters[2];
+    dpiSodaColl *coll;
+    char buffer[100];
+    dpiSodaDb *db;
+
+    // get SODA database (Oracle Client 18.5 required for bulk insert)
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 18, 5) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getSodaDb(testCase, &db) < 0)
+        return DPI_FAILURE;
+
+    // create SODA collection
+    if (dpiSodaDb_createCollection(db, collName, strlen(collName), NULL, 0,
+            DPI_SODA_FLAGS_DEFAULT, &coll) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // configure batching
+    counters[0] = counters[1] = 0;
+    if (dpiSodaColl_setInsertBatching(coll, 3, DPI_SODA_FLAGS_ATOMIC_COMMIT,
+            dpiTest__insertBatchCallback, counters) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // add documents; only full batches should be inserted
+    for (i = 0; i < numDocs; i++) {
+        sprintf(buffer, "{\"test\":\"2619 content%d\"}", i + 1);
+        if (dpiSodaColl_insertBatched(coll, NULL, 0, buffer,
+                strlen(buffer)) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiTestCase_expectUintEqual(testCase, counters[0], 2) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, counters[1], 6) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__countDocuments(testCase, coll, NULL, 6) < 0)
+        return DPI_FAILURE;
+
+    // flush the remaining documents
+    if (dpiSodaColl_flushInsert(coll) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, counters[0], 3) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, counters[1], numDocs) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__countDocuments(testCase, coll, NULL, numDocs) < 0)
+        return DPI_FAILURE;
+
+    // flushing an empty batch does nothing
+    if (dpiSodaColl_flushInsert(coll) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, counters[0], 3) < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiTestCase_cleanupSodaColl(testCase, coll) < 0)
+        return DPI_FAILURE;
+    if (dpiSodaDb_release(db) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_3520()
+//   Add a batch of documents containing invalid JSON with
+// dpiSodaColl_insertBatched() and verify that the insert of the batch fails,
+// that the offset identifies the document in the batch and that the batch is
+// empty afterwards.
+//-----------------------------------------------------------------------------
+int dpiTest_3520(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *expectedErrors[] = { "ORA-02290:", "ORA-40479:", "ORA-40780:",
+            NULL };
+    const char *contents[4] = {
+        "{\"test1\" : \"2620 content1\"}",
+        "{\"test2 : 2620 content2\"}",
+        "{\"test3\" : \"2620 content3\"}",
+        "{\"test4\" : \"2620 content4\"}"
+    };
+    const char *collName = "ODPIC_COLL_2620";
+    dpiErrorInfo errorInfo;
+    uint64_t counters[2];
+    dpiSodaColl *coll;
+    dpiSodaDb *db;
+    uint32_t i;
+
+    // get SODA database (Oracle Client 18.5 required for bulk insert)
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 18, 5) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getSodaDb(testCase, &db) < 0)
+        return DPI_FAILURE;
+
+    // create SODA collection
+    if (dpiSodaDb_createCollection(db, collName, strlen(collName), NULL, 0,
+            DPI_SODA_FLAGS_DEFAULT, &coll) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // add the documents and verify the insert fails
+    counters[0] = counters[1] = 0;
+    if (dpiSodaColl_setInsertBatching(coll, 4, DPI_SODA_FLAGS_ATOMIC_COMMIT,
+            dpiTest__insertBatchCallback, counters) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < 3; i++) {
+        if (dpiSodaColl_insertBatched(coll, NULL, 0, contents[i],
+                strlen(contents[i])) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    dpiSodaColl_insertBatched(coll, NULL, 0, contents[3],
+            strlen(contents[3]));
+    if (dpiTestCase_expectAnyError(testCase, expectedErrors) < 0)
+        return DPI_FAILURE;
+    dpiTestSuite_getErrorInfo(&errorInfo);
+    if (dpiTestCase_expectUintEqual(testCase, errorInfo.offset, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, counters[0], 0) < 0)
+        return DPI_FAILURE;
+
+    // the batch should be empty
+    if (dpiSodaColl_flushInsert(coll) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, counters[0], 0) < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiTestCase_cleanupSodaColl(testCase, coll) < 0)
+        return DPI_FAILURE;
+    if (dpiSodaDb_release(db) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -1486,5 +1660,9 @@ int main(int argc, char **argv)
             "dpiSodaColl_save() with valid parameters");
     dpiTestSuite_addCase(dpiTest_3518,
             "fetch documents with different fetchArraySize options");
+    dpiTestSuite_addCase(dpiTest_3519,
+            "dpiSodaColl_insertBatched() with valid parameters");
+    dpiTestSuite_addCase(dpiTest_3520,
+            "dpiSodaColl_insertBatched() with invalid JSON");
     return dpiTestSuite_run();
 }
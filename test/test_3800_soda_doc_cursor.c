@@ -66,6 +66,9 @@ int dpiTest_3800(dpiTestCase *testCase, dpiTestParams *params)
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiSodaDocCursor_getNext(NULL, DPI_SODA_FLAGS_DEFAULT, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiSodaDocCursor_getNextMany(NULL, DPI_SODA_FLAGS_DEFAULT, 0, NULL, NULL);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiSodaDocCursor_release(NULL);
@@ -116,6 +119,73 @@ int dpiTest_3801(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_3802()
+//   Insert a number of documents into a collection and then fetch them using
+// dpiSodaDocCursor_getNextMany() with a batch size that does not evenly
+// divide the number of documents; verify the number fetched (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_3802(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *collName = "ODPIC_COLL_3802";
+    const char *content = "{\"test\" : \"value\"}";
+    uint32_t i, numDocs, totalDocs, numBatches;
+    dpiSodaDoc *docs[7], *doc;
+    dpiSodaDocCursor *cursor;
+    dpiSodaColl *coll;
+    dpiSodaDb *db;
+
+    // create collection and insert documents
+    if (dpiTestCase_getSodaDb(testCase, &db) < 0)
+        return DPI_FAILURE;
+    if (dpiSodaDb_createCollection(db, collName, strlen(collName), NULL, 0,
+            DPI_SODA_FLAGS_DEFAULT, &coll) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < 20; i++) {
+        if (dpiSodaDb_createDocument(db, NULL, 0, content, strlen(content),
+                NULL, 0, DPI_SODA_FLAGS_DEFAULT, &doc) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiSodaColl_insertOne(coll, doc, DPI_SODA_FLAGS_ATOMIC_COMMIT,
+                NULL) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiSodaDoc_release(doc) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+
+    // fetch documents in batches
+    if (dpiSodaColl_find(coll, NULL, DPI_SODA_FLAGS_DEFAULT, &cursor) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    totalDocs = numBatches = 0;
+    while (1) {
+        if (dpiSodaDocCursor_getNextMany(cursor, DPI_SODA_FLAGS_DEFAULT, 7,
+                docs, &numDocs) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (numDocs == 0)
+            break;
+        numBatches++;
+        totalDocs += numDocs;
+        for (i = 0; i < numDocs; i++) {
+            if (dpiSodaDoc_release(docs[i]) < 0)
+                return dpiTestCase_setFailedFromError(testCase);
+        }
+    }
+    if (dpiTestCase_expectUintEqual(testCase, totalDocs, 20) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, numBatches, 3) < 0)
+        return DPI_FAILURE;
+    if (dpiSodaDocCursor_release(cursor) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // cleanup
+    if (dpiTestCase_cleanupSodaColl(testCase, coll) < 0)
+        return DPI_FAILURE;
+    if (dpiSodaDb_release(db) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -126,5 +196,7 @@ int main(int argc, char **argv)
             "call all functions with NULL handle");
     dpiTestSuite_addCase(dpiTest_3801,
             "dpiSodaDocCursor_addRef() with valid parameters");
+    dpiTestSuite_addCase(dpiTest_3802,
+            "dpiSodaDocCursor_getNextMany() returns all documents");
     return dpiTestSuite_run();
 }
@@ -103,9 +103,15 @@ int dpiTest_4000(dpiTestCase *testCase, dpiTestParams *params)
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiQueue_enqMany(NULL, 0, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiQueue_enqBatched(NULL, NULL);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiQueue_enqOne(NULL, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiQueue_flushEnq(NULL);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiQueue_getDeqOptions(NULL, NULL);
@@ -115,6 +121,9 @@ int dpiTest_4000(dpiTestCase *testCase, dpiTestParams *params)
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiQueue_release(NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiQueue_setEnqBatching(NULL, 0, 0);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
 
@@ -683,6 +692,197 @@ int dpiTest_4008(dpiTestCase *testCase, dpiTestParams *params)
     return DPI_SUCCESS;
 }
 
+//-----------------------------------------------------------------------------
+// dpiTest_4009()
+//   Create a queue, enqueue some messages and dequeue them in two batches,
+// releasing the message properties of the first batch before dequeuing the
+// second. Verify that the released message properties are reused and that the
+// payloads match what was enqueued (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4009(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiMsgProps *firstProps[NUM_BATCH_DEQ], *deqProps[NUM_BATCH_DEQ];
+    dpiMsgProps *enqProps;
+    uint32_t i, j, numMessages, payloadLength;
+    const char *payloads[NUM_BATCH_DEQ * 2] = {
+        "Message 1", "Message 2", "Message 3", "Message 4",
+        "Message 5", "Message 6", "Message 7", "Message 8",
+        "Message 9", "Message 10", "Message 11", "Message 12",
+        "Message 13", "Message 14", "Message 15", "Message 16"
+    };
+    dpiDeqOptions *deqOptions;
+    const char *payload;
+    dpiQueue *queue;
+    dpiConn *conn;
+    int reused;
+
+    // create queue; ensure it is cleared so that errors don't cascade
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__clearQueue(testCase, conn, RAW_QUEUE_NAME, NULL) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newQueue(conn, RAW_QUEUE_NAME, strlen(RAW_QUEUE_NAME), NULL,
+            &queue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // enqueue messages
+    if (dpiConn_newMsgProps(conn, &enqProps) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < NUM_BATCH_DEQ * 2; i++) {
+        if (dpiMsgProps_setPayloadBytes(enqProps, payloads[i],
+                strlen(payloads[i])) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiQueue_enqOne(queue, enqProps) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiMsgProps_release(enqProps) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // get dequeue options from queue and set some options
+    if (dpiQueue_getDeqOptions(queue, &deqOptions) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiDeqOptions_setNavigation(deqOptions, DPI_DEQ_NAV_FIRST_MSG) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiDeqOptions_setWait(deqOptions, DPI_DEQ_WAIT_NO_WAIT) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // dequeue the first batch and release the message properties
+    numMessages = NUM_BATCH_DEQ;
+    if (dpiQueue_deqMany(queue, &numMessages, firstProps) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numMessages,
+            NUM_BATCH_DEQ) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < numMessages; i++) {
+        if (dpiMsgProps_release(firstProps[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+
+    // dequeue the second batch and verify the message properties were reused
+    numMessages = NUM_BATCH_DEQ;
+    if (dpiQueue_deqMany(queue, &numMessages, deqProps) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numMessages,
+            NUM_BATCH_DEQ) < 0)
+        return DPI_FAILURE;
+    reused = 0;
+    for (i = 0; i < numMessages; i++) {
+        for (j = 0; j < NUM_BATCH_DEQ; j++) {
+            if (deqProps[i] == firstProps[j])
+                reused = 1;
+        }
+        if (dpiMsgProps_getPayload(deqProps[i], NULL, &payload,
+                &payloadLength) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTestCase_expectStringEqual(testCase, payload, payloadLength,
+                payloads[NUM_BATCH_DEQ + i],
+                strlen(payloads[NUM_BATCH_DEQ + i])) < 0)
+            return DPI_FAILURE;
+    }
+    if (!reused)
+        return dpiTestCase_setFailed(testCase,
+                "message properties were not reused");
+
+    // release the queue before the message properties to verify that
+    // outstanding message properties keep the queue valid
+    if (dpiQueue_release(queue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < numMessages; i++) {
+        if (dpiMsgProps_release(deqProps[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4010()
+//   Create a queue and enable batching of enqueued messages. Add more
+// messages to the batch than the batch size and verify that only a full batch
+// has been enqueued before the remaining messages are flushed. Then verify
+// that all messages can be dequeued (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4010(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *payloads[NUM_BATCH_DEQ] = {
+        "Batched 1", "Batched 2", "Batched 3", "Batched 4",
+        "Batched 5", "Batched 6", "Batched 7", "Batched 8"
+    };
+    dpiMsgProps *props[NUM_BATCH_DEQ];
+    uint32_t i, numMessages, msgIdLength;
+    dpiDeqOptions *deqOptions;
+    const char *msgId;
+    dpiQueue *queue;
+    dpiConn *conn;
+
+    // create queue; ensure it is cleared so that errors don't cascade
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__clearQueue(testCase, conn, RAW_QUEUE_NAME, NULL) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newQueue(conn, RAW_QUEUE_NAME, strlen(RAW_QUEUE_NAME), NULL,
+            &queue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiQueue_setEnqBatching(queue, NUM_BATCH_ENQ, 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // add messages to the batch
+    for (i = 0; i < NUM_BATCH_DEQ; i++) {
+        if (dpiConn_newMsgProps(conn, &props[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiMsgProps_setPayloadBytes(props[i], payloads[i],
+                strlen(payloads[i])) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiQueue_enqBatched(queue, props[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+
+    // verify only the first batch was enqueued, then flush the remainder
+    for (i = 0; i < NUM_BATCH_DEQ; i++) {
+        if (dpiMsgProps_getMsgId(props[i], &msgId, &msgIdLength) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (i < NUM_BATCH_ENQ && msgIdLength == 0)
+            return dpiTestCase_setFailed(testCase,
+                    "message in full batch was not enqueued");
+        if (i >= NUM_BATCH_ENQ && msgIdLength != 0)
+            return dpiTestCase_setFailed(testCase,
+                    "message in partial batch was enqueued");
+    }
+    if (dpiQueue_flushEnq(queue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < NUM_BATCH_DEQ; i++) {
+        if (dpiMsgProps_getMsgId(props[i], &msgId, &msgIdLength) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (msgIdLength == 0)
+            return dpiTestCase_setFailed(testCase,
+                    "message was not enqueued after flush");
+        if (dpiMsgProps_release(props[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+
+    // verify all messages can be dequeued
+    if (dpiQueue_getDeqOptions(queue, &deqOptions) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiDeqOptions_setWait(deqOptions, DPI_DEQ_WAIT_NO_WAIT) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    numMessages = NUM_BATCH_DEQ;
+    if (dpiQueue_deqMany(queue, &numMessages, props) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numMessages,
+            NUM_BATCH_DEQ) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < numMessages; i++) {
+        if (dpiMsgProps_release(props[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiQueue_release(queue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -707,6 +907,10 @@ int main(int argc, char **argv)
             "bulk dequeue of objects matches what was enqueued");
     dpiTestSuite_addCase(dpiTest_4008,
             "verify dequeue by message id");
+    dpiTestSuite_addCase(dpiTest_4009,
+            "verify message properties are reused after release");
+    dpiTestSuite_addCase(dpiTest_4010,
+            "verify batched enqueue of messages");
 
     return dpiTestSuite_run();
 }
@@ -2605,6 +2605,278 @@ int dpiTest_4132(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_4133()
+//   Verify that binding NUMBER arrays IN/OUT using dpiVar_setFromColumn() and
+// dpiVar_getColumn() works as expected (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4133(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql =
+            "begin pkg_TestNumberArrays.TestInOutArrays(:1, :2); end;";
+    uint32_t numElements = 100000, i, numElementsOut;
+    dpiData *numElementsValue, *arrayValue;
+    dpiVar *numElementsVar, *arrayVar;
+    int64_t *values;
+    uint8_t *nullBitmap;
+    dpiStmt *stmt;
+    dpiConn *conn;
+
+    // get connection
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+
+    // create variables
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64, 1,
+            0, 0, 0, NULL, &numElementsVar, &numElementsValue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64,
+            numElements, 0, 0, 1, NULL, &arrayVar, &arrayValue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // populate bind variables with values; setting the column also sets the
+    // number of elements in the array
+    values = malloc(numElements * sizeof(int64_t));
+    nullBitmap = malloc((numElements + 7) / 8);
+    if (!values || !nullBitmap)
+        return dpiTestCase_setFailed(testCase, "Out of memory!");
+    for (i = 0; i < numElements; i++)
+        values[i] = (i + 1) * 2;
+    dpiData_setInt64(numElementsValue, numElements);
+    if (dpiVar_setFromColumn(arrayVar, 0, numElements, values, NULL,
+            NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_getNumElementsInArray(arrayVar, &numElementsOut) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numElementsOut,
+            numElements) < 0)
+        return DPI_FAILURE;
+
+    // prepare statement and bind values
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, numElementsVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 2, arrayVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // execute statement and verify values returned match expectations
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_getNumElementsInArray(arrayVar, &numElementsOut) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numElementsOut,
+            numElements) < 0)
+        return DPI_FAILURE;
+    if (dpiVar_getColumn(arrayVar, 0, numElementsOut, values, NULL, NULL,
+            nullBitmap) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < numElementsOut; i++) {
+        if (!(nullBitmap[i / 8] & (1 << (i % 8))))
+            return dpiTestCase_setFailed(testCase, "unexpected null value");
+        if (dpiTestCase_expectIntEqual(testCase, values[i],
+                (i + 1) * 20) < 0)
+            return DPI_FAILURE;
+    }
+
+    // cleanup
+    free(values);
+    free(nullBitmap);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(numElementsVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(arrayVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4134()
+//   Verify that binding string (VARCHAR2) arrays OUT and retrieving the values
+// using dpiVar_getColumn() works as expected (no error); a buffer that is too
+// small returns the size required (error DPI-1019).
+//-----------------------------------------------------------------------------
+int dpiTest_4134(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql =
+            "begin pkg_TestStringArrays.TestOutArrays(:1, :2); end;";
+    const char *outValueFormat = "Test out element # %u";
+    uint32_t numElements = 2000, numElementsOut, i, valuesLength;
+    dpiData *numElementsValue, *arrayValue;
+    dpiVar *numElementsVar, *arrayVar;
+    uint32_t *offsets;
+    char buffer[300];
+    dpiStmt *stmt;
+    dpiConn *conn;
+    char *values;
+
+    // get connection
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+
+    // create variables
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64, 1,
+            0, 0, 0, NULL, &numElementsVar, &numElementsValue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_VARCHAR, DPI_NATIVE_TYPE_BYTES,
+            numElements, 100, 0, 1, NULL, &arrayVar, &arrayValue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // populate bind variables with values
+    dpiData_setInt64(numElementsValue, numElements);
+    if (dpiVar_setNumElementsInArray(arrayVar, 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // prepare statement and bind values
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, numElementsVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 2, arrayVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // perform execution
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_getNumElementsInArray(arrayVar, &numElementsOut) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectIntEqual(testCase, numElementsOut, numElements) < 0)
+        return DPI_FAILURE;
+
+    // determine the size of buffer required
+    offsets = malloc((numElementsOut + 1) * sizeof(uint32_t));
+    if (!offsets)
+        return dpiTestCase_setFailed(testCase, "Out of memory!");
+    valuesLength = 0;
+    dpiVar_getColumn(arrayVar, 0, numElementsOut, NULL, &valuesLength,
+            offsets, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1019:") < 0)
+        return DPI_FAILURE;
+
+    // verify values returned match expectations
+    values = malloc(valuesLength);
+    if (!values)
+        return dpiTestCase_setFailed(testCase, "Out of memory!");
+    if (dpiVar_getColumn(arrayVar, 0, numElementsOut, values, &valuesLength,
+            offsets, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, offsets[numElementsOut],
+            valuesLength) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < numElementsOut; i++) {
+        sprintf(buffer, outValueFormat, i + 1);
+        if (dpiTestCase_expectStringEqual(testCase, values + offsets[i],
+                offsets[i + 1] - offsets[i], buffer, strlen(buffer)) < 0)
+            return DPI_FAILURE;
+    }
+
+    // cleanup
+    free(values);
+    free(offsets);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(numElementsVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(arrayVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4135()
+//   Verify that binding BINARY_DOUBLE arrays containing nulls IN/OUT using
+// dpiVar_setFromColumn() and dpiVar_getColumn() works as expected and that
+// the null bitmap returned identifies the null values (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4135(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql =
+            "begin pkg_TestNumberArrays.TestInOutBinaryDoubleArrays(:1, :2); "
+            "end;";
+    uint32_t numElements = 20, i, numElementsOut;
+    dpiData *numElementsValue, *arrayValue;
+    dpiVar *numElementsVar, *arrayVar;
+    uint8_t nullBitmap[3];
+    double values[20];
+    dpiStmt *stmt;
+    dpiConn *conn;
+    int isNull;
+
+    // get connection
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+
+    // create variables
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64, 1,
+            0, 0, 0, NULL, &numElementsVar, &numElementsValue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NATIVE_DOUBLE,
+            DPI_NATIVE_TYPE_DOUBLE, numElements, 0, 0, 1, NULL, &arrayVar,
+            &arrayValue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // populate bind variables with values; every third value is null
+    memset(nullBitmap, 0, sizeof(nullBitmap));
+    for (i = 0; i < numElements; i++) {
+        values[i] = (i + 1) * 2.5;
+        if (i % 3 != 1)
+            nullBitmap[i / 8] |= (uint8_t) (1 << (i % 8));
+    }
+    dpiData_setInt64(numElementsValue, numElements);
+    if (dpiVar_setFromColumn(arrayVar, 0, numElements, values, NULL,
+            nullBitmap) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // prepare statement and bind values
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, numElementsVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 2, arrayVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // execute statement and verify values and nulls returned match
+    // expectations; null values are returned as zero
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_getNumElementsInArray(arrayVar, &numElementsOut) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numElementsOut,
+            numElements) < 0)
+        return DPI_FAILURE;
+    memset(values, 0xff, sizeof(values));
+    memset(nullBitmap, 0xff, sizeof(nullBitmap));
+    if (dpiVar_getColumn(arrayVar, 0, numElementsOut, values, NULL, NULL,
+            nullBitmap) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < numElementsOut; i++) {
+        isNull = !(nullBitmap[i / 8] & (1 << (i % 8)));
+        if (dpiTestCase_expectIntEqual(testCase, isNull, i % 3 == 1) < 0)
+            return DPI_FAILURE;
+        if (dpiTestCase_expectDoubleEqual(testCase, values[i],
+                (isNull) ? 0 : (i + 1) * 25.0) < 0)
+            return DPI_FAILURE;
+    }
+    if (dpiTestCase_expectUintEqual(testCase, nullBitmap[2] & 0xf0, 0) < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(numElementsVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(arrayVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -2677,5 +2949,11 @@ int main(int argc, char **argv)
             "test PL/SQL bind of BLOBs (IN/OUT)");
     dpiTestSuite_addCase(dpiTest_4132,
             "test PL/SQL bind of BLOBs (OUT)");
+    dpiTestSuite_addCase(dpiTest_4133,
+            "test PL/SQL bind of number array using columns (IN/OUT)");
+    dpiTestSuite_addCase(dpiTest_4134,
+            "test PL/SQL bind of string array using columns (OUT)");
+    dpiTestSuite_addCase(dpiTest_4135,
+            "test PL/SQL bind of native double array with nulls (IN/OUT)");
     return dpiTestSuite_run();
 }
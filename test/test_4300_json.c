@@ -64,6 +64,12 @@ int dpiTest_4300(dpiTestCase *testCase, dpiTestParams *params)
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiJson_getValue(NULL, 0, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiJson_getValueFromOson(NULL, NULL, 0, NULL, 0, 0, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiJson_getText(NULL, NULL, NULL, NULL);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiJson_setValue(NULL, NULL);
@@ -1162,6 +1168,440 @@ int dpiTest_4311(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_4312()
+//   Set the value using dpiJson_setFromText() to an array containing a large
+// number of small objects and call dpiJson_getValue() several times with
+// different options, verifying the contents each time. Then set the value to
+// an empty array and verify that no elements are returned.
+//-----------------------------------------------------------------------------
+int dpiTest_4312(dpiTestCase *testCase, dpiTestParams *params)
+{
+    uint32_t numObjects = 2000, i, pass, textLength, numLength;
+    const char *emptyText = "[]";
+    dpiJsonNode *topNode, *node;
+    char *text, numBuffer[20];
+    dpiJsonObject *obj;
+    dpiJsonArray *array;
+    dpiData *data;
+    dpiConn *conn;
+    dpiVar *var;
+
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 21, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+
+    // build JSON text
+    text = malloc(numObjects * 40 + 2);
+    if (!text)
+        return dpiTestCase_setFailed(testCase, "Out of memory!");
+    textLength = 0;
+    text[textLength++] = '[';
+    for (i = 0; i < numObjects; i++)
+        textLength += (uint32_t) sprintf(text + textLength,
+                "%s{\"id\":%u,\"inner\":{\"v\":%u}}", (i > 0) ? "," : "",
+                i, i * 7);
+    text[textLength++] = ']';
+
+    // create variable and populate it with the JSON text
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_JSON, DPI_NATIVE_TYPE_JSON, 1, 0,
+            0, 0, NULL, &var, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    data->isNull = 0;
+    if (dpiJson_setFromText(dpiData_getJson(data), text, textLength, 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    free(text);
+
+    // get the value several times and verify the contents
+    for (pass = 0; pass < 3; pass++) {
+        if (dpiJson_getValue(dpiData_getJson(data),
+                (pass == 1) ? DPI_JSON_OPT_NUMBER_AS_STRING :
+                DPI_JSON_OPT_DEFAULT, &topNode) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        array = &topNode->value->asJsonArray;
+        if (dpiTestCase_expectUintEqual(testCase, array->numElements,
+                numObjects) < 0)
+            return DPI_FAILURE;
+        for (i = 0; i < numObjects; i++) {
+            obj = &array->elements[i].value->asJsonObject;
+            if (dpiTestCase_expectUintEqual(testCase, obj->numFields, 2) < 0)
+                return DPI_FAILURE;
+            node = &obj->fields[1].value->asJsonObject.fields[0];
+            if (pass == 1) {
+                numLength = (uint32_t) sprintf(numBuffer, "%u", i * 7);
+                if (dpiTestCase_expectStringEqual(testCase,
+                        node->value->asBytes.ptr, node->value->asBytes.length,
+                        numBuffer, numLength) < 0)
+                    return DPI_FAILURE;
+            } else if (dpiTestCase_expectDoubleEqual(testCase,
+                    node->value->asDouble, i * 7) < 0) {
+                return DPI_FAILURE;
+            }
+        }
+    }
+
+    // set an empty array and verify no elements are returned
+    if (dpiJson_setFromText(dpiData_getJson(data), emptyText,
+            strlen(emptyText), 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiJson_getValue(dpiData_getJson(data), DPI_JSON_OPT_DEFAULT,
+            &topNode) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    array = &topNode->value->asJsonArray;
+    if (dpiTestCase_expectUintEqual(testCase, array->numElements, 0) < 0)
+        return DPI_FAILURE;
+    if (array->elements)
+        return dpiTestCase_setFailed(testCase,
+                "elements returned for empty array");
+
+    // cleanup
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4313()
+//   Call dpiJson_getValueFromOson() with OSON data containing a scalar string
+// and verify the value is decoded correctly.
+//-----------------------------------------------------------------------------
+int dpiTest_4313(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char oson[] = {
+        '\xff', 'J', 'Z', '\x01',           // magic bytes and version
+        '\x00', '\x10',                     // flags (scalar)
+        '\x00', '\x04',                     // size of tree segment
+        '\x03', 'a', 'b', 'c'               // string of length 3
+    };
+    dpiJsonNode *topNode;
+    dpiData *data;
+    dpiConn *conn;
+    dpiVar *var;
+
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 21, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_JSON, DPI_NATIVE_TYPE_JSON, 1, 0,
+            0, 0, NULL, &var, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiJson_getValueFromOson(dpiData_getJson(data), oson, sizeof(oson),
+            NULL, 0, DPI_JSON_OPT_DEFAULT, &topNode) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, topNode->oracleTypeNum,
+            DPI_ORACLE_TYPE_VARCHAR) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectStringEqual(testCase, topNode->value->asBytes.ptr,
+            topNode->value->asBytes.length, "abc", 3) < 0)
+        return DPI_FAILURE;
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4314()
+//   Call dpiJson_getValueFromOson() with OSON data containing an object, both
+// without a path and with paths identifying a field, a missing field and an
+// array element (which does not exist since the value is an object).
+//-----------------------------------------------------------------------------
+int dpiTest_4314(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char oson[] = {
+        '\xff', 'J', 'Z', '\x01',           // magic bytes and version
+        '\x00', '\x00',                     // flags
+        '\x02',                             // number of field names
+        '\x00', '\x08',                     // size of field names segment
+        '\x00', '\x0d',                     // size of tree segment
+        '\x00', '\x00',                     // number of tiny nodes
+        '\x00', '\x00',                     // field name hash ids
+        '\x00', '\x00', '\x00', '\x03',     // field name offsets
+        '\x02', 'i', 'd',                   // field name "id"
+        '\x04', 'n', 'a', 'm', 'e',         // field name "name"
+        '\x80', '\x02',                     // object with 2 fields
+        '\x01', '\x02',                     // field ids
+        '\x00', '\x08', '\x00', '\x0b',     // field offsets
+        '\x42', '\xc1', '\x06',             // number 5
+        '\x01', 'x'                         // string "x"
+    };
+    dpiJsonNode *topNode;
+    dpiJsonObject *obj;
+    dpiData *data;
+    dpiConn *conn;
+    dpiVar *var;
+    dpiJson *json;
+
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 21, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_JSON, DPI_NATIVE_TYPE_JSON, 1, 0,
+            0, 0, NULL, &var, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    json = dpiData_getJson(data);
+
+    // decode the entire document
+    if (dpiJson_getValueFromOson(json, oson, sizeof(oson), NULL, 0,
+            DPI_JSON_OPT_DEFAULT, &topNode) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    obj = &topNode->value->asJsonObject;
+    if (dpiTestCase_expectUintEqual(testCase, obj->numFields, 2) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectStringEqual(testCase, obj->fieldNames[0],
+            obj->fieldNameLengths[0], "id", 2) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectDoubleEqual(testCase,
+            obj->fields[0].value->asDouble, 5) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectStringEqual(testCase, obj->fieldNames[1],
+            obj->fieldNameLengths[1], "name", 4) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectStringEqual(testCase,
+            obj->fields[1].value->asBytes.ptr,
+            obj->fields[1].value->asBytes.length, "x", 1) < 0)
+        return DPI_FAILURE;
+
+    // decode only the field identified by a path
+    if (dpiJson_getValueFromOson(json, oson, sizeof(oson), "$.name", 6,
+            DPI_JSON_OPT_DEFAULT, &topNode) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (!topNode)
+        return dpiTestCase_setFailed(testCase, "field not found");
+    if (dpiTestCase_expectStringEqual(testCase, topNode->value->asBytes.ptr,
+            topNode->value->asBytes.length, "x", 1) < 0)
+        return DPI_FAILURE;
+
+    // paths that do not identify a node return NULL
+    if (dpiJson_getValueFromOson(json, oson, sizeof(oson), "missing", 7,
+            DPI_JSON_OPT_DEFAULT, &topNode) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (topNode)
+        return dpiTestCase_setFailed(testCase, "missing field found");
+    if (dpiJson_getValueFromOson(json, oson, sizeof(oson), "$[0]", 4,
+            DPI_JSON_OPT_DEFAULT, &topNode) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (topNode)
+        return dpiTestCase_setFailed(testCase, "array element found");
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4315()
+//   Call dpiJson_getValueFromOson() with invalid OSON data (error DPI-1094)
+// and with an invalid path (error DPI-1095).
+//-----------------------------------------------------------------------------
+int dpiTest_4315(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char invalidOson[] = { '\xff', 'J', 'X', '\x01' };
+    const char truncatedOson[] = {
+        '\xff', 'J', 'Z', '\x01', '\x00', '\x10', '\x00', '\x04', '\x03', 'a'
+    };
+    dpiJsonNode *topNode;
+    dpiData *data;
+    dpiConn *conn;
+    dpiVar *var;
+    dpiJson *json;
+
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 21, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_JSON, DPI_NATIVE_TYPE_JSON, 1, 0,
+            0, 0, NULL, &var, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    json = dpiData_getJson(data);
+    dpiJson_getValueFromOson(json, invalidOson, sizeof(invalidOson), NULL, 0,
+            DPI_JSON_OPT_DEFAULT, &topNode);
+    if (dpiTestCase_expectError(testCase, "DPI-1094:") < 0)
+        return DPI_FAILURE;
+    dpiJson_getValueFromOson(json, truncatedOson, sizeof(truncatedOson), NULL,
+            0, DPI_JSON_OPT_DEFAULT, &topNode);
+    if (dpiTestCase_expectError(testCase, "DPI-1094:") < 0)
+        return DPI_FAILURE;
+    dpiJson_getValueFromOson(json, truncatedOson, sizeof(truncatedOson),
+            "$.a[x]", 6, DPI_JSON_OPT_DEFAULT, &topNode);
+    if (dpiTestCase_expectError(testCase, "DPI-1095:") < 0)
+        return DPI_FAILURE;
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4316()
+//   Call dpiJson_getText() with a hierarchy of nodes containing strings that
+// require escaping and floating point values that must be written in their
+// shortest form and verify the text that is returned.
+//-----------------------------------------------------------------------------
+int dpiTest_4316(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *expectedText =
+            "{\"str\":\"tab\\there \\\"quoted\\\" back\\\\slash\\u0001\","
+            "\"num\":1.25,\"arr\":[true,null,-7,0.1,0.3333333333333333]}";
+    char *fieldNames[3] = { "str", "num", "arr" };
+    uint32_t fieldNameLengths[3] = { 3, 3, 3 };
+    dpiDataBuffer topValue, fieldValues[3], elementValues[5];
+    dpiJsonNode topNode, fields[3], elements[5];
+    const char *str = "tab\there \"quoted\" back\\slash\x01";
+    uint64_t textLength;
+    const char *text;
+    dpiData *data;
+    dpiConn *conn;
+    dpiVar *var;
+    uint32_t i;
+
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 21, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+
+    // build the hierarchy of nodes
+    for (i = 0; i < 3; i++)
+        fields[i].value = &fieldValues[i];
+    for (i = 0; i < 5; i++)
+        elements[i].value = &elementValues[i];
+    topNode.value = &topValue;
+    topNode.oracleTypeNum = DPI_ORACLE_TYPE_JSON_OBJECT;
+    topNode.nativeTypeNum = DPI_NATIVE_TYPE_JSON_OBJECT;
+    topValue.asJsonObject.numFields = 3;
+    topValue.asJsonObject.fieldNames = fieldNames;
+    topValue.asJsonObject.fieldNameLengths = fieldNameLengths;
+    topValue.asJsonObject.fields = fields;
+    topValue.asJsonObject.fieldValues = fieldValues;
+    fields[0].oracleTypeNum = DPI_ORACLE_TYPE_VARCHAR;
+    fields[0].nativeTypeNum = DPI_NATIVE_TYPE_BYTES;
+    fieldValues[0].asBytes.ptr = (char*) str;
+    fieldValues[0].asBytes.length = (uint32_t) strlen(str);
+    fields[1].oracleTypeNum = DPI_ORACLE_TYPE_NUMBER;
+    fields[1].nativeTypeNum = DPI_NATIVE_TYPE_DOUBLE;
+    fieldValues[1].asDouble = 1.25;
+    fields[2].oracleTypeNum = DPI_ORACLE_TYPE_JSON_ARRAY;
+    fields[2].nativeTypeNum = DPI_NATIVE_TYPE_JSON_ARRAY;
+    fieldValues[2].asJsonArray.numElements = 5;
+    fieldValues[2].asJsonArray.elements = elements;
+    fieldValues[2].asJsonArray.elementValues = elementValues;
+    elements[0].oracleTypeNum = DPI_ORACLE_TYPE_BOOLEAN;
+    elements[0].nativeTypeNum = DPI_NATIVE_TYPE_BOOLEAN;
+    elementValues[0].asBoolean = 1;
+    elements[1].oracleTypeNum = DPI_ORACLE_TYPE_NONE;
+    elements[1].nativeTypeNum = DPI_NATIVE_TYPE_NULL;
+    elements[2].oracleTypeNum = DPI_ORACLE_TYPE_NUMBER;
+    elements[2].nativeTypeNum = DPI_NATIVE_TYPE_INT64;
+    elementValues[2].asInt64 = -7;
+    elements[3].oracleTypeNum = DPI_ORACLE_TYPE_NATIVE_FLOAT;
+    elements[3].nativeTypeNum = DPI_NATIVE_TYPE_FLOAT;
+    elementValues[3].asFloat = 0.1f;
+    elements[4].oracleTypeNum = DPI_ORACLE_TYPE_NATIVE_DOUBLE;
+    elements[4].nativeTypeNum = DPI_NATIVE_TYPE_DOUBLE;
+    elementValues[4].asDouble = 1.0 / 3;
+
+    // serialize the nodes and verify the text
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_JSON, DPI_NATIVE_TYPE_JSON, 1, 0,
+            0, 0, NULL, &var, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiJson_getText(dpiData_getJson(data), &topNode, &text,
+            &textLength) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectStringEqual(testCase, text, textLength,
+            expectedText, strlen(expectedText)) < 0)
+        return DPI_FAILURE;
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4317()
+//   Set the value using dpiJson_setFromText() and call dpiJson_getText()
+// without a node, verifying that the original text is returned.
+//-----------------------------------------------------------------------------
+int dpiTest_4317(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *jsonText =
+            "{\"id\":12345678901234567890,\"name\":\"x\\\"y\","
+            "\"values\":[1.5,-2,true,false,null]}";
+    uint64_t textLength;
+    const char *text;
+    dpiData *data;
+    dpiConn *conn;
+    dpiVar *var;
+
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 21, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_JSON, DPI_NATIVE_TYPE_JSON, 1, 0,
+            0, 0, NULL, &var, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    data->isNull = 0;
+    if (dpiJson_setFromText(dpiData_getJson(data), jsonText,
+            strlen(jsonText), 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiJson_getText(dpiData_getJson(data), NULL, &text, &textLength) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectStringEqual(testCase, text, textLength, jsonText,
+            strlen(jsonText)) < 0)
+        return DPI_FAILURE;
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4318()
+//   Call dpiJson_getValueFromOson() with OSON data containing an array whose
+// only element refers back to the array itself (error DPI-1094).
+//-----------------------------------------------------------------------------
+int dpiTest_4318(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char oson[] = {
+        '\xff', 'J', 'Z', '\x01',           // magic bytes and version
+        '\x00', '\x00',                     // flags
+        '\x00',                             // number of field names
+        '\x00', '\x00',                     // size of field names segment
+        '\x00', '\x04',                     // size of tree segment
+        '\x00', '\x00',                     // number of tiny nodes
+        '\xc0', '\x01',                     // array with 1 element
+        '\x00', '\x00'                      // element offset (the array)
+    };
+    dpiJsonNode *topNode;
+    dpiData *data;
+    dpiConn *conn;
+    dpiVar *var;
+
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 21, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_JSON, DPI_NATIVE_TYPE_JSON, 1, 0,
+            0, 0, NULL, &var, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiJson_getValueFromOson(dpiData_getJson(data), oson, sizeof(oson), NULL,
+            0, DPI_JSON_OPT_DEFAULT, &topNode);
+    if (dpiTestCase_expectError(testCase, "DPI-1094:") < 0)
+        return DPI_FAILURE;
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -1192,5 +1632,19 @@ int main(int argc, char **argv)
             "insert and fetch JSON array native double values");
     dpiTestSuite_addCase(dpiTest_4311,
             "insert and fetch JSON array native float values");
+    dpiTestSuite_addCase(dpiTest_4312,
+            "call dpiJson_getValue() repeatedly with many objects");
+    dpiTestSuite_addCase(dpiTest_4313,
+            "call dpiJson_getValueFromOson() with a scalar value");
+    dpiTestSuite_addCase(dpiTest_4314,
+            "call dpiJson_getValueFromOson() with an object and paths");
+    dpiTestSuite_addCase(dpiTest_4315,
+            "call dpiJson_getValueFromOson() with invalid data and path");
+    dpiTestSuite_addCase(dpiTest_4316,
+            "call dpiJson_getText() with a hierarchy of nodes");
+    dpiTestSuite_addCase(dpiTest_4317,
+            "call dpiJson_getText() after dpiJson_setFromText()");
+    dpiTestSuite_addCase(dpiTest_4318,
+            "call dpiJson_getValueFromOson() with a self-referencing array");
     return dpiTestSuite_run();
 }
@@ -297,6 +297,12 @@ int dpiTest_4400(dpiTestCase *testCase, dpiTestParams *params)
     if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 23, 4) < 0)
         return DPI_FAILURE;
     dpiVector_addRef(NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiVector_getDistance(NULL, NULL, DPI_VECTOR_DISTANCE_COSINE, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiVector_getDistances(NULL, 0, NULL, DPI_VECTOR_DISTANCE_COSINE, NULL);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiVector_getValue(NULL, NULL);
@@ -306,6 +312,10 @@ int dpiTest_4400(dpiTestCase *testCase, dpiTestParams *params)
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiVar_setFromVector(NULL, 0, NULL);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiVar_setFromVectorMatrix(NULL, 0, 0, DPI_VECTOR_FORMAT_FLOAT32, 0, NULL,
+            NULL, NULL, NULL);
     if (dpiTestCase_expectError(testCase, expectedError) < 0)
         return DPI_FAILURE;
     dpiConn_newVector(NULL, NULL, NULL);
@@ -1036,6 +1046,541 @@ int dpiTest_4430(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_4431()
+//   Calculate the distances between vectors of different formats using each
+// of the supported metrics and verify the results; verify that the cosine
+// distance of vectors with very large components does not overflow; verify
+// that vectors with different numbers of dimensions (error DPI-1099) and
+// unsupported metrics (error DPI-1100) are rejected.
+//-----------------------------------------------------------------------------
+int dpiTest_4431(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiVectorDistanceMetric metrics[5] = {
+        DPI_VECTOR_DISTANCE_EUCLIDEAN, DPI_VECTOR_DISTANCE_EUCLIDEAN_SQUARED,
+        DPI_VECTOR_DISTANCE_MANHATTAN, DPI_VECTOR_DISTANCE_DOT,
+        DPI_VECTOR_DISTANCE_HAMMING
+    };
+    double expectedDistances[5] = { 4, 16, 8, -50, 4 }, distances[2];
+    dpiVector *vec1, *vec2, *vec3, *vec4, *vec5, *vec6, *vectors[2];
+    double values2[4] = { 3, 4, 5, 6 }, values5[4], values6[4];
+    float values1[4] = { 1, 2, 3, 4 }, values4[3] = { 1, 2, 3 };
+    int8_t values3[4] = { 2, 4, 6, 8 };
+    dpiVectorInfo vectorInfo;
+    double distance;
+    dpiConn *conn;
+    int i;
+
+    // create vectors
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 1, 23, 4) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    dpiTest__getVectorInfo(&vectorInfo, DPI_VECTOR_FORMAT_FLOAT32, 4,
+            values1);
+    if (dpiConn_newVector(conn, &vectorInfo, &vec1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiTest__getVectorInfo(&vectorInfo, DPI_VECTOR_FORMAT_FLOAT64, 4,
+            values2);
+    if (dpiConn_newVector(conn, &vectorInfo, &vec2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiTest__getVectorInfo(&vectorInfo, DPI_VECTOR_FORMAT_INT8, 4, values3);
+    if (dpiConn_newVector(conn, &vectorInfo, &vec3) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiTest__getVectorInfo(&vectorInfo, DPI_VECTOR_FORMAT_FLOAT32, 3,
+            values4);
+    if (dpiConn_newVector(conn, &vectorInfo, &vec4) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // verify distances between a pair of vectors
+    for (i = 0; i < 5; i++) {
+        if (dpiVector_getDistance(vec1, vec2, metrics[i], &distance) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTestCase_expectDoubleEqual(testCase, distance,
+                expectedDistances[i]) < 0)
+            return DPI_FAILURE;
+    }
+    if (dpiVector_getDistance(vec1, vec3, DPI_VECTOR_DISTANCE_COSINE,
+            &distance) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectDoubleEqual(testCase, distance, 0) < 0)
+        return DPI_FAILURE;
+
+    // verify distances between a vector and a number of vectors
+    vectors[0] = vec2;
+    vectors[1] = vec3;
+    if (dpiVector_getDistances(vec1, 2, vectors, DPI_VECTOR_DISTANCE_DOT,
+            distances) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectDoubleEqual(testCase, distances[0], -50) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectDoubleEqual(testCase, distances[1], -60) < 0)
+        return DPI_FAILURE;
+
+    // verify the cosine distance of parallel vectors whose squared magnitudes
+    // overflow when multiplied together (components are 2^400 and 2^401)
+    values5[0] = 1;
+    for (i = 0; i < 400; i++)
+        values5[0] *= 2;
+    for (i = 0; i < 4; i++) {
+        values5[i] = values5[0];
+        values6[i] = values5[0] * 2;
+    }
+    dpiTest__getVectorInfo(&vectorInfo, DPI_VECTOR_FORMAT_FLOAT64, 4,
+            values5);
+    if (dpiConn_newVector(conn, &vectorInfo, &vec5) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiTest__getVectorInfo(&vectorInfo, DPI_VECTOR_FORMAT_FLOAT64, 4,
+            values6);
+    if (dpiConn_newVector(conn, &vectorInfo, &vec6) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVector_getDistance(vec5, vec6, DPI_VECTOR_DISTANCE_COSINE,
+            &distance) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectDoubleEqual(testCase, distance, 0) < 0)
+        return DPI_FAILURE;
+
+    // verify errors
+    dpiVector_getDistance(vec1, vec4, DPI_VECTOR_DISTANCE_COSINE, &distance);
+    if (dpiTestCase_expectError(testCase, "DPI-1099:") < 0)
+        return DPI_FAILURE;
+    dpiVector_getDistance(vec1, vec2, DPI_VECTOR_DISTANCE_JACCARD, &distance);
+    if (dpiTestCase_expectError(testCase, "DPI-1100:") < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiVector_release(vec1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVector_release(vec2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVector_release(vec3) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVector_release(vec4) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVector_release(vec5) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVector_release(vec6) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4432()
+//   Insert a FLOAT64 vector and a null vector; fetch both rows and call
+// dpiVar_getVectorMatrix() to convert them to a FLOAT32 matrix; verify the
+// matrix and null bitmap are as expected; call dpiVar_getVectorMatrix() with
+// the wrong number of dimensions (error DPI-1099).
+//-----------------------------------------------------------------------------
+int dpiTest_4432(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql = "insert into TestVectors (IntCol) values (2)";
+    const char *selectSql =
+            "select Vector64Col from TestVectors order by IntCol";
+    double values[] = {1.5, -2.25, 0, 4, 5.75, 6, 7.5, -8, 9.125, 10};
+    uint32_t bufferRowIndex, numRowsFetched, i;
+    dpiVectorInfo vectorInfo;
+    float matrix[2][10];
+    uint8_t nullBitmap;
+    dpiData *data;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    dpiVar *var;
+    int moreRows;
+
+    // populate table with a vector and a null vector
+    dpiTest__getVectorInfo(&vectorInfo, DPI_VECTOR_FORMAT_FLOAT64, 10,
+            values);
+    if (dpiTest__populateTable(testCase, "Vector64Col", &vectorInfo,
+            NULL) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_COMMIT_ON_SUCCESS, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // fetch the rows using a variable defined for the column
+    if (dpiConn_prepareStmt(conn, 0, selectSql, strlen(selectSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_VECTOR, DPI_NATIVE_TYPE_VECTOR,
+            5, 0, 0, 0, NULL, &var, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_define(stmt, 1, var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetchRows(stmt, 5, &bufferRowIndex, &numRowsFetched,
+            &moreRows) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numRowsFetched, 2) < 0)
+        return DPI_FAILURE;
+
+    // verify the matrix
+    if (dpiVar_getVectorMatrix(var, bufferRowIndex, numRowsFetched,
+            DPI_VECTOR_FORMAT_FLOAT32, 10, matrix, &nullBitmap) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, nullBitmap, 1) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < 10; i++) {
+        if (dpiTestCase_expectDoubleEqual(testCase, matrix[0][i],
+                values[i]) < 0)
+            return DPI_FAILURE;
+        if (dpiTestCase_expectDoubleEqual(testCase, matrix[1][i], 0) < 0)
+            return DPI_FAILURE;
+    }
+
+    // verify the number of dimensions is checked
+    dpiVar_getVectorMatrix(var, bufferRowIndex, 1, DPI_VECTOR_FORMAT_FLOAT32,
+            8, matrix, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1099:") < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4433()
+//   Bind a FLOAT32 matrix of three rows (one of which is null) using
+// dpiVar_setFromVectorMatrix() and insert them with dpiStmt_executeMany();
+// fetch the rows and verify they match; call dpiVar_setFromVectorMatrix()
+// with decreasing row offsets (error DPI-1096).
+//-----------------------------------------------------------------------------
+int dpiTest_4433(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql =
+            "insert into TestVectors (IntCol, Vector32Col) values (:1, :2)";
+    const char *selectSql =
+            "select Vector32Col from TestVectors order by IntCol";
+    const char *truncateSql = "delete from TestVectors";
+    uint32_t rowOffsets[] = {2, 1, 3}, sparseIndices[] = {0, 1, 2};
+    uint32_t bufferRowIndex, numRowsFetched, numQueryColumns, i, j;
+    dpiData *intData, *vectorData;
+    float matrix[3][10], result[3][10];
+    uint8_t nullBitmap = 5;
+    dpiVar *intVar, *vectorVar;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    int moreRows;
+
+    // populate the matrix and remove any existing rows
+    for (i = 0; i < 3; i++) {
+        for (j = 0; j < 10; j++)
+            matrix[i][j] = (float) (i * 10 + j) / 4;
+    }
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, truncateSql, strlen(truncateSql), NULL,
+            0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, &numQueryColumns) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // insert the rows of the matrix
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64, 3,
+            0, 0, 0, NULL, &intVar, &intData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_VECTOR, DPI_NATIVE_TYPE_VECTOR,
+            3, 0, 0, 0, NULL, &vectorVar, &vectorData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < 3; i++) {
+        intData[i].isNull = 0;
+        intData[i].value.asInt64 = i + 1;
+    }
+    if (dpiVar_setFromVectorMatrix(vectorVar, 0, 3, DPI_VECTOR_FORMAT_FLOAT32,
+            10, matrix, NULL, NULL, &nullBitmap) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 2, vectorVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_executeMany(stmt, DPI_MODE_EXEC_COMMIT_ON_SUCCESS, 3) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // verify the offsets are checked
+    dpiVar_setFromVectorMatrix(vectorVar, 0, 2, DPI_VECTOR_FORMAT_FLOAT32, 10,
+            matrix, rowOffsets, sparseIndices, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1096:") < 0)
+        return DPI_FAILURE;
+    if (dpiVar_release(vectorVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // fetch the rows and verify they match
+    if (dpiConn_prepareStmt(conn, 0, selectSql, strlen(selectSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_VECTOR, DPI_NATIVE_TYPE_VECTOR,
+            5, 0, 0, 0, NULL, &vectorVar, &vectorData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_define(stmt, 1, vectorVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetchRows(stmt, 5, &bufferRowIndex, &numRowsFetched,
+            &moreRows) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numRowsFetched, 3) < 0)
+        return DPI_FAILURE;
+    nullBitmap = 0;
+    if (dpiVar_getVectorMatrix(vectorVar, bufferRowIndex, numRowsFetched,
+            DPI_VECTOR_FORMAT_FLOAT32, 10, result, &nullBitmap) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, nullBitmap, 5) < 0)
+        return DPI_FAILURE;
+    for (j = 0; j < 10; j++) {
+        if (dpiTestCase_expectDoubleEqual(testCase, result[0][j],
+                matrix[0][j]) < 0)
+            return DPI_FAILURE;
+        if (dpiTestCase_expectDoubleEqual(testCase, result[2][j],
+                matrix[2][j]) < 0)
+            return DPI_FAILURE;
+    }
+
+    // cleanup
+    if (dpiVar_release(vectorVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4434()
+//   Bind a sparse FLOAT32 matrix in CSR format with rows of different lengths
+// (one of which is empty) using dpiVar_setFromVectorMatrix() and insert them
+// with dpiStmt_executeMany(); fetch the rows as dense vectors and verify that
+// they match (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4434(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql =
+            "insert into TestVectors (IntCol, Vector32Col) "
+            "values (:1, vector(:2, 10, float32, dense))";
+    const char *selectSql =
+            "select Vector32Col from TestVectors order by IntCol";
+    const char *truncateSql = "delete from TestVectors";
+    float values[] = {1.5f, -2.25f, 3.0f, 0.5f, 4.0f, -1.0f, 7.25f, 2.0f};
+    uint32_t sparseIndices[] = {0, 4, 9, 2, 3, 5, 7, 8};
+    uint32_t rowOffsets[] = {0, 3, 3, 8};
+    uint32_t bufferRowIndex, numRowsFetched, numQueryColumns, i, j;
+    float expected[3][10], result[3][10];
+    dpiData *intData, *vectorData;
+    dpiVar *intVar, *vectorVar;
+    uint8_t nullBitmap;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    int moreRows;
+
+    // build the expected dense matrix and remove any existing rows
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 23, 7) < 0)
+        return DPI_FAILURE;
+    memset(expected, 0, sizeof(expected));
+    for (i = 0; i < 3; i++) {
+        for (j = rowOffsets[i]; j < rowOffsets[i + 1]; j++)
+            expected[i][sparseIndices[j]] = values[j];
+    }
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, truncateSql, strlen(truncateSql), NULL,
+            0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, &numQueryColumns) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // insert the rows of the sparse matrix
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64, 3,
+            0, 0, 0, NULL, &intVar, &intData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_VECTOR, DPI_NATIVE_TYPE_VECTOR,
+            3, 0, 0, 0, NULL, &vectorVar, &vectorData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < 3; i++) {
+        intData[i].isNull = 0;
+        intData[i].value.asInt64 = i + 1;
+    }
+    if (dpiVar_setFromVectorMatrix(vectorVar, 0, 3, DPI_VECTOR_FORMAT_FLOAT32,
+            10, values, rowOffsets, sparseIndices, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 2, vectorVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_executeMany(stmt, DPI_MODE_EXEC_COMMIT_ON_SUCCESS, 3) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(vectorVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // fetch the rows and verify they match
+    if (dpiConn_prepareStmt(conn, 0, selectSql, strlen(selectSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_VECTOR, DPI_NATIVE_TYPE_VECTOR,
+            5, 0, 0, 0, NULL, &vectorVar, &vectorData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_define(stmt, 1, vectorVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetchRows(stmt, 5, &bufferRowIndex, &numRowsFetched,
+            &moreRows) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numRowsFetched, 3) < 0)
+        return DPI_FAILURE;
+    nullBitmap = 0;
+    if (dpiVar_getVectorMatrix(vectorVar, bufferRowIndex, numRowsFetched,
+            DPI_VECTOR_FORMAT_FLOAT32, 10, result, &nullBitmap) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, nullBitmap, 7) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < 3; i++) {
+        for (j = 0; j < 10; j++) {
+            if (dpiTestCase_expectDoubleEqual(testCase, result[i][j],
+                    expected[i][j]) < 0)
+                return DPI_FAILURE;
+        }
+    }
+
+    // cleanup
+    if (dpiVar_release(vectorVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4435()
+//   Calculate the Hamming and Jaccard distances between binary vectors whose
+// length is not a multiple of four bytes; calculate the distances between two
+// sparse vectors and between a dense vector and a sparse vector using each of
+// the metrics and verify the results (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4435(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiVectorDistanceMetric metrics[4] = {
+        DPI_VECTOR_DISTANCE_EUCLIDEAN_SQUARED, DPI_VECTOR_DISTANCE_MANHATTAN,
+        DPI_VECTOR_DISTANCE_DOT, DPI_VECTOR_DISTANCE_COSINE
+    };
+    uint8_t binary1[9] = { 0xff, 0, 0, 0, 0x0f, 0, 0, 0, 0x81 };
+    uint8_t binary2[9] = { 0x0f, 0, 0, 0, 0x0f, 0, 0, 0, 0x01 };
+    double expectedDistances[4] = { 21, 9, -12, 1 - 12.0 / 18.0 };
+    double dense[8] = { 2, 0, 0, 0, 1, 0, 2, 0 };
+    uint32_t indices1[3] = { 1, 4, 6 }, indices2[3] = { 0, 4, 6 };
+    float sparse1[3] = { 2, 4, 4 }, sparse2[3] = { 2, 1, 2 };
+    dpiVector *vec1, *vec2, *vec3;
+    dpiVectorInfo vectorInfo;
+    double distance;
+    dpiConn *conn;
+    int i;
+
+    // verify the distances between binary vectors; the last byte is counted
+    // separately from the first eight
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 1, 23, 7) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    dpiTest__getVectorInfo(&vectorInfo, DPI_VECTOR_FORMAT_BINARY, 72,
+            binary1);
+    if (dpiConn_newVector(conn, &vectorInfo, &vec1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiTest__getVectorInfo(&vectorInfo, DPI_VECTOR_FORMAT_BINARY, 72,
+            binary2);
+    if (dpiConn_newVector(conn, &vectorInfo, &vec2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVector_getDistance(vec1, vec2, DPI_VECTOR_DISTANCE_HAMMING,
+            &distance) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectDoubleEqual(testCase, distance, 5) < 0)
+        return DPI_FAILURE;
+    if (dpiVector_getDistance(vec1, vec2, DPI_VECTOR_DISTANCE_JACCARD,
+            &distance) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectDoubleEqual(testCase, distance,
+            1 - 9.0 / 14.0) < 0)
+        return DPI_FAILURE;
+    if (dpiVector_release(vec1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVector_release(vec2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // create two sparse vectors and a dense vector matching the second one
+    dpiTest__getVectorInfo(&vectorInfo, DPI_VECTOR_FORMAT_FLOAT32, 8,
+            sparse1);
+    vectorInfo.isSparse = 1;
+    vectorInfo.numSparseValues = 3;
+    vectorInfo.sparseIndices = indices1;
+    if (dpiConn_newVector(conn, &vectorInfo, &vec1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    vectorInfo.dimensions.asPtr = sparse2;
+    vectorInfo.sparseIndices = indices2;
+    if (dpiConn_newVector(conn, &vectorInfo, &vec2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiTest__getVectorInfo(&vectorInfo, DPI_VECTOR_FORMAT_FLOAT64, 8, dense);
+    if (dpiConn_newVector(conn, &vectorInfo, &vec3) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // verify the distances between the sparse vectors and between the dense
+    // vector and the first sparse vector
+    for (i = 0; i < 4; i++) {
+        if (dpiVector_getDistance(vec1, vec2, metrics[i], &distance) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTestCase_expectDoubleEqual(testCase, distance,
+                expectedDistances[i]) < 0)
+            return DPI_FAILURE;
+        if (dpiVector_getDistance(vec3, vec1, metrics[i], &distance) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTestCase_expectDoubleEqual(testCase, distance,
+                expectedDistances[i]) < 0)
+            return DPI_FAILURE;
+    }
+
+    // cleanup
+    if (dpiVector_release(vec1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVector_release(vec2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVector_release(vec3) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -1104,6 +1649,16 @@ int main(int argc, char **argv)
             "insert Json array into vector");
     dpiTestSuite_addCase(dpiTest_4430,
             "update vector and verify");
+    dpiTestSuite_addCase(dpiTest_4431,
+            "calculate distances between vectors");
+    dpiTestSuite_addCase(dpiTest_4432,
+            "fetch vectors into a matrix");
+    dpiTestSuite_addCase(dpiTest_4433,
+            "insert vectors from a matrix with executeMany");
+    dpiTestSuite_addCase(dpiTest_4434,
+            "insert sparse vectors from a CSR matrix with executeMany");
+    dpiTestSuite_addCase(dpiTest_4435,
+            "calculate distances between binary and sparse vectors");
     return dpiTestSuite_run();
 }
 
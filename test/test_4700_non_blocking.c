@@ -0,0 +1,427 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// test_4700_non_blocking.c
+//   Test suite for testing connections in non-blocking mode.
+//-----------------------------------------------------------------------------
+
+#include "TestLib.h"
+
+// OCI handle type and attribute used to read the mode from the server handle
+#define OCI_HTYPE_SERVER                8
+#define OCI_ATTR_NONBLOCKING_MODE       3
+
+//-----------------------------------------------------------------------------
+// dpiTest__expectServerMode() [INTERNAL]
+//   Verifies that the non-blocking mode set on the OCI server handle of the
+// connection matches the expected mode.
+//-----------------------------------------------------------------------------
+int dpiTest__expectServerMode(dpiTestCase *testCase, dpiConn *conn,
+        int expectedEnabled)
+{
+    uint32_t valueLength;
+    dpiDataBuffer value;
+
+    if (dpiConn_getOciAttr(conn, OCI_HTYPE_SERVER, OCI_ATTR_NONBLOCKING_MODE,
+            &value, &valueLength) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    return dpiTestCase_expectIntEqual(testCase, value.asUint8 != 0,
+            expectedEnabled);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest__isStillExecuting() [INTERNAL]
+//   Returns whether or not the last error raised indicates that the call is
+// still executing (error DPI-1090).
+//-----------------------------------------------------------------------------
+int dpiTest__isStillExecuting(void)
+{
+    const char *expectedError = "DPI-1090:";
+    dpiErrorInfo errorInfo;
+    dpiContext *context;
+
+    dpiTestSuite_getContext(&context);
+    dpiContext_getError(context, &errorInfo);
+    return (errorInfo.messageLength >= strlen(expectedError) &&
+            strncmp(errorInfo.message, expectedError,
+                    strlen(expectedError)) == 0);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4700()
+//   Call each of the non-blocking mode functions with the connection parameter
+// set to NULL (error DPI-1002).
+//-----------------------------------------------------------------------------
+int dpiTest_4700(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *expectedError = "DPI-1002:";
+    int enabled;
+
+    dpiConn_getNonBlocking(NULL, &enabled);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+    dpiConn_setNonBlocking(NULL, 1);
+    if (dpiTestCase_expectError(testCase, expectedError) < 0)
+        return DPI_FAILURE;
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4701()
+//   Enable and disable non-blocking mode on a connection and verify that the
+// mode reported by the connection and the mode set on the OCI server handle
+// both match (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4701(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiConn *conn;
+    int enabled;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_getNonBlocking(conn, &enabled) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectIntEqual(testCase, enabled, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__expectServerMode(testCase, conn, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_setNonBlocking(conn, 1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_setNonBlocking(conn, 1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_getNonBlocking(conn, &enabled) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectIntEqual(testCase, enabled, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__expectServerMode(testCase, conn, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_setNonBlocking(conn, 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_getNonBlocking(conn, &enabled) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectIntEqual(testCase, enabled, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__expectServerMode(testCase, conn, 0) < 0)
+        return DPI_FAILURE;
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4702()
+//   Execute a query and fetch its rows on a connection in non-blocking mode,
+// calling each function again until it is no longer still executing, and
+// verify the value fetched (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4702(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select 7 from dual";
+    dpiNativeTypeNum nativeTypeNum;
+    uint32_t bufferRowIndex;
+    dpiData *data;
+    dpiStmt *stmt;
+    dpiConn *conn;
+    int found;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_setNonBlocking(conn, 1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    while (dpiStmt_execute(stmt, 0, NULL) < 0) {
+        if (!dpiTest__isStillExecuting())
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiStmt_defineValue(stmt, 1, DPI_ORACLE_TYPE_NUMBER,
+            DPI_NATIVE_TYPE_INT64, 0, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    while (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0) {
+        if (!dpiTest__isStillExecuting())
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiTestCase_expectIntEqual(testCase, found, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_getQueryValue(stmt, 1, &nativeTypeNum, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectIntEqual(testCase, dpiData_getInt64(data), 7) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4703()
+//   Insert a row and commit on a connection in non-blocking mode, calling
+// each function again until it is no longer still executing, and verify that
+// the row is visible from a second connection (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4703(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql = "insert into TestTempTable (IntCol) values (1)";
+    const char *truncateSql = "truncate table TestTempTable";
+    const char *countSql = "select count(*) from TestTempTable";
+    dpiNativeTypeNum nativeTypeNum;
+    uint32_t bufferRowIndex;
+    dpiConn *conn, *conn2;
+    dpiData *data;
+    dpiStmt *stmt;
+    int found;
+
+    // truncate the table and insert and commit a row in non-blocking mode
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, truncateSql, strlen(truncateSql), NULL,
+            0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_setNonBlocking(conn, 1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    while (dpiStmt_execute(stmt, 0, NULL) < 0) {
+        if (!dpiTest__isStillExecuting())
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    while (dpiConn_commit(conn) < 0) {
+        if (!dpiTest__isStillExecuting())
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiConn_release(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // verify the row is visible from a second connection
+    if (dpiTestCase_getConnection(testCase, &conn2) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn2, 0, countSql, strlen(countSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_defineValue(stmt, 1, DPI_ORACLE_TYPE_NUMBER,
+            DPI_NATIVE_TYPE_INT64, 0, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_getQueryValue(stmt, 1, &nativeTypeNum, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectIntEqual(testCase, dpiData_getInt64(data), 1) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4704()
+//   Enqueue some messages and then dequeue them in a batch on a connection in
+// non-blocking mode, calling dpiQueue_deqMany() again until it is no longer
+// still executing, and verify the payloads dequeued (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4704(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *payloads[3] = { "Message 1", "Message 2", "Message 3" };
+    const char *queueName = "RAW_QUEUE", *payload;
+    uint32_t i, numProps, payloadLength;
+    dpiDeqOptions *deqOptions;
+    dpiMsgProps *props[5];
+    dpiQueue *queue;
+    dpiConn *conn;
+
+    // create queue and remove any messages that may already be present
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newQueue(conn, queueName, strlen(queueName), NULL,
+            &queue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiQueue_getDeqOptions(queue, &deqOptions) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiDeqOptions_setWait(deqOptions, DPI_DEQ_WAIT_NO_WAIT) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    while (1) {
+        if (dpiQueue_deqOne(queue, &props[0]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (!props[0])
+            break;
+        if (dpiMsgProps_release(props[0]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+
+    // enqueue messages
+    if (dpiConn_newMsgProps(conn, &props[0]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < 3; i++) {
+        if (dpiMsgProps_setPayloadBytes(props[0], payloads[i],
+                strlen(payloads[i])) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiQueue_enqOne(queue, props[0]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiMsgProps_release(props[0]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_commit(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // dequeue messages in non-blocking mode
+    if (dpiConn_setNonBlocking(conn, 1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    numProps = 5;
+    while (dpiQueue_deqMany(queue, &numProps, props) < 0) {
+        if (!dpiTest__isStillExecuting())
+            return dpiTestCase_setFailedFromError(testCase);
+        numProps = 5;
+    }
+    if (dpiTestCase_expectUintEqual(testCase, numProps, 3) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < numProps; i++) {
+        if (dpiMsgProps_getPayload(props[i], NULL, &payload,
+                &payloadLength) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTestCase_expectStringEqual(testCase, payload, payloadLength,
+                payloads[i], strlen(payloads[i])) < 0)
+            return DPI_FAILURE;
+        if (dpiMsgProps_release(props[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    while (dpiConn_commit(conn) < 0) {
+        if (!dpiTest__isStillExecuting())
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiQueue_release(queue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4705()
+//   Start a dequeue of a batch of messages on an empty queue with a wait on a
+// connection in non-blocking mode, break execution while it is still
+// executing and verify that a subsequent dequeue of a smaller batch starts a
+// new dequeue instead of continuing the abandoned one (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4705(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *queueName = "RAW_QUEUE";
+    dpiDeqOptions *deqOptions;
+    dpiMsgProps *props[5];
+    uint32_t numProps;
+    dpiQueue *queue;
+    dpiConn *conn;
+
+    // create queue and remove any messages that may already be present
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newQueue(conn, queueName, strlen(queueName), NULL,
+            &queue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiQueue_getDeqOptions(queue, &deqOptions) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiDeqOptions_setWait(deqOptions, DPI_DEQ_WAIT_NO_WAIT) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    while (1) {
+        if (dpiQueue_deqOne(queue, &props[0]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (!props[0])
+            break;
+        if (dpiMsgProps_release(props[0]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiConn_commit(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // start a dequeue that waits for messages and break it while it is still
+    // executing
+    if (dpiDeqOptions_setWait(deqOptions, 10) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_setNonBlocking(conn, 1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    numProps = 5;
+    if (dpiQueue_deqMany(queue, &numProps, props) == DPI_SUCCESS)
+        return dpiTestCase_setSkipped(testCase,
+                "dequeue completed before it could be broken");
+    if (!dpiTest__isStillExecuting())
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_breakExecution(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // a dequeue with a smaller array must not attempt to continue the
+    // abandoned dequeue (which would fail as the array is too small)
+    if (dpiDeqOptions_setWait(deqOptions, DPI_DEQ_WAIT_NO_WAIT) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    numProps = 1;
+    while (dpiQueue_deqMany(queue, &numProps, props) < 0) {
+        if (!dpiTest__isStillExecuting())
+            return dpiTestCase_setFailedFromError(testCase);
+        numProps = 1;
+    }
+    if (dpiTestCase_expectUintEqual(testCase, numProps, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_setNonBlocking(conn, 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiQueue_release(queue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// main()
+//-----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+    dpiTestSuite_initialize(4700);
+    dpiTestSuite_addCase(dpiTest_4700,
+            "call non-blocking mode functions with NULL connection");
+    dpiTestSuite_addCase(dpiTest_4701,
+            "enable and disable non-blocking mode");
+    dpiTestSuite_addCase(dpiTest_4702,
+            "execute and fetch in non-blocking mode");
+    dpiTestSuite_addCase(dpiTest_4703,
+            "insert and commit in non-blocking mode");
+    dpiTestSuite_addCase(dpiTest_4704,
+            "dequeue messages in non-blocking mode");
+    dpiTestSuite_addCase(dpiTest_4705,
+            "break a dequeue in non-blocking mode and dequeue again");
+    return dpiTestSuite_run();
+}